@@ -20,7 +20,7 @@ void setup() {
   Serial.begin(115200);
   while (!Serial);
   Serial << F("----------------------------------\n");
-  Serial << F("Sketch ") << getBaseName(__FILE__) << F(" running...\n");
+  Serial << F("Sketch ") << SKETCH_NAME << F(" running...\n");
   Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
 
   /*
@@ -80,6 +80,8 @@ void setup() {
    * Show amount of free memory.
    */
   Serial << F("free memory = ") << TrappmannRobotics::getFreeMemory() << F(" Bytes\n");
+  Serial << F("heap map:\n");
+  TrappmannRobotics::printHeapMap(Serial);
 
   /*
    * Check if the MCU Status Register gets passed to the sketch.
@@ -195,7 +197,7 @@ void showSignature() {
       [TEMP] "d"  (tempByte)
   );  
 
-  Serial << F("CPU signature bytes: ") << toHexString(sig1) << " " << toHexString(sig2) << " " << toHexString(sig3) << " = ";
+  Serial << F("CPU signature bytes: ") << hex8(sig1) << " " << hex8(sig2) << " " << hex8(sig3) << " = ";
   if (0x1E == sig1) {
     if ((0x94 == sig2) && (0x06 == sig3)) {
       Serial << F("ATmega168\n");
@@ -276,10 +278,10 @@ void showFuseBytes() {
       [TEMP] "d"  (tempByte)
   );
 
-  Serial << F("BL Lock Bits   = 0b") << toBinaryString(lockBits)     << F(" = 0x") << toHexString(lockBits) << LF;
-  Serial << F("Fuse Low Byte  = 0b") << toBinaryString(lowFuseByte)  << F(" = 0x") << toHexString(lowFuseByte) << LF;
-  Serial << F("Fuse High Byte = 0b") << toBinaryString(highFuseByte) << F(" = 0x") << toHexString(highFuseByte) << LF;
-  Serial << F("Ext. Fuse Byte = 0b") << toBinaryString(extFuseByte)  << F(" = 0x") << toHexString(extFuseByte) << LF;
+  Serial << F("BL Lock Bits   = 0b") << bin8(lockBits)     << F(" = 0x") << hex8(lockBits) << LF;
+  Serial << F("Fuse Low Byte  = 0b") << bin8(lowFuseByte)  << F(" = 0x") << hex8(lowFuseByte) << LF;
+  Serial << F("Fuse High Byte = 0b") << bin8(highFuseByte) << F(" = 0x") << hex8(highFuseByte) << LF;
+  Serial << F("Ext. Fuse Byte = 0b") << bin8(extFuseByte)  << F(" = 0x") << hex8(extFuseByte) << LF;
 }
 
 /*
@@ -21,7 +21,7 @@ void setup() {
 
   Serial.begin(115200);
   Serial << F("------------------------------\n");
-  Serial << F("Sketch: ") << getBaseName(__FILE__) << LF;
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
   Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
   Serial << F("Free Memory: ") << TrappmannRobotics::getFreeMemory() << LF;
   Serial << F("Address of setup() function 0x") << toHexString(((uint32_t)setup) << 1) << LF;
@@ -0,0 +1,33 @@
+// NAME: BinaryTelemetry.ino
+//
+// DESC: Streams sensor samples as compact binary frames with COBS framing and
+//       CRC-16 to Serial. Decode them on the host with:
+//         python3 extras/decode_frames.py <port> 115200
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/BinaryFrame.h>
+
+// frame type and field ids of this Sketch
+#define FRAME_SAMPLE  1
+
+#define ID_TIME       0
+#define ID_X          1
+#define ID_Y          2
+#define ID_Z          3
+
+BinaryFrame<24> frame;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+}
+
+void loop() {
+  frame.begin(FRAME_SAMPLE);
+  frame.add(ID_TIME, (uint32_t)millis());
+  frame.add(ID_X, (int16_t)analogRead(A0));
+  frame.add(ID_Y, (int16_t)analogRead(A1));
+  frame.add(ID_Z, (int16_t)analogRead(A2));
+  frame.send(Serial);
+}
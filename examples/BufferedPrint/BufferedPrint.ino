@@ -0,0 +1,82 @@
+// NAME: BufferedPrint.ino
+//
+// DESC: Benchmark for printing formatted lines with and without BufferedPrint.
+//       Shows CPU cycles per line and the number of write calls which reach
+//       the underlying Print object.
+//
+
+#include <TrappmannRobotics.h>
+
+#define LINES 100
+
+/*
+ * Print sink, which discards all data but counts the write calls, to measure
+ * the pure formatting overhead without waiting for the serial interface.
+ */
+class NullPrint : public Print {
+public:
+  uint32_t writes = 0;
+
+  virtual size_t write(uint8_t c) { writes++; return 1; }
+  virtual size_t write(const uint8_t *buffer, size_t size) { writes++; return size; }
+};
+
+void printLine(Print& out, uint16_t i) {
+  out << F("Free memory at IRQ = ") << TrappmannRobotics::getFreeMemory() << F(" bytes, loop #") << i << LF;
+}
+
+uint32_t measure(Print& out) {
+  uint32_t start = micros();
+  for (uint16_t i=0; i<LINES; i++) {
+    printLine(out, i);
+  }
+  return micros() - start;
+}
+
+uint32_t measureBuffered(Print& out) {
+  BufferedPrint<64> buffered(out);
+  uint32_t start = micros();
+  for (uint16_t i=0; i<LINES; i++) {
+    printLine(buffered, i);
+  }
+  buffered.flush();
+  return micros() - start;
+}
+
+void report(const __FlashStringHelper *name, uint32_t usec) {
+  Serial << name << padLeft(usec * clockCyclesPerMicrosecond() / LINES, 8) << F(" cycles/line\n");
+}
+
+void report(const __FlashStringHelper *name, uint32_t usec, uint32_t writes) {
+  Serial << name << padLeft(usec * clockCyclesPerMicrosecond() / LINES, 8) << F(" cycles/line, ")
+         << padLeft(writes, 6) << F(" writes\n");
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("------------------------------\n");
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+  Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
+
+  NullPrint sink;
+  uint32_t usec = measure(sink);
+  report(F("NullPrint unbuffered:"), usec, sink.writes);
+
+  sink.writes = 0;
+  usec = measureBuffered(sink);
+  report(F("NullPrint buffered:  "), usec, sink.writes);
+
+  Serial.flush();
+  usec = measure(Serial);
+  Serial.flush();
+  report(F("Serial unbuffered:   "), usec);
+
+  usec = measureBuffered(Serial);
+  Serial.flush();
+  report(F("Serial buffered:     "), usec);
+
+  Serial << F("Done.\n");
+}
+
+void loop() {}
@@ -36,7 +36,7 @@ void setup() {
   Serial.begin(115200);
   while (!Serial);
   Serial << F("------------------------------\n");
-  Serial << F("Sketch: ") << getBaseName(__FILE__) << LF;
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
   Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
   Serial << F("Free Memory: ") << TrappmannRobotics::getFreeMemory() << F(" bytes\n");
   Serial << F("Reset Flags: 0b") << toBinaryString(System::getResetFlags()) << ": ";
@@ -5,6 +5,7 @@
 #define DEBUG 1
 #include <TrappmannRobotics.h>
 #include <TrappmannRobotics/SketchConfiguration.h>
+#include <TrappmannRobotics/HexDump.h>
 
 #define MAGIC_HEADER_ID     42
 
@@ -36,15 +37,8 @@ void setup() {
 }
 
 void dumpEEPROM(Print& out) {
-  out.print("SystemConfig: ");
-  for (int i=0; i<sizeof(config); i++) {
-    uint8_t value;
-    EEPROM.get(EEPROM_CONFIG_ADDR+i, value);
-    String buffer = "0" + String(value, HEX);
-    out.print(buffer.substring(buffer.length()-2));
-    out.print(" ");
-  }
-  out.println();
+  out.print("SystemConfig:\n");
+  hexDump(out, HEXDUMP_EEPROM, EEPROM_CONFIG_ADDR, sizeof(config));
 }
 
 void loop() {}
@@ -0,0 +1,80 @@
+// NAME: DecimalBenchmark.ino
+//
+// DESC: Cycle count benchmark of the decimal kernels of the stream operator
+//       against Print::print() of the Arduino core. Timer1 runs without a
+//       prescaler to count CPU cycles. The output of both is compared to
+//       verify that it is byte-identical.
+//
+
+#include <TrappmannRobotics.h>
+
+/*
+ * Print sink, which keeps the last printed number for comparison.
+ */
+class CapturePrint : public Print {
+public:
+  char buffer[16];
+  uint8_t len = 0;
+
+  virtual size_t write(uint8_t c) { if (len < sizeof(buffer)) buffer[len++] = c; return 1; }
+  void clear() { len = 0; }
+  bool equals(const CapturePrint& other) { return (len == other.len) && (0 == memcmp(buffer, other.buffer, len)); }
+};
+
+CapturePrint corePrint;
+CapturePrint streamPrint;
+bool identical = true;
+
+void startTimer() {
+  TCCR1A = 0;
+  TCCR1B = (1<<CS10); // no prescaler, count CPU cycles
+  TCNT1 = 0;
+}
+
+uint16_t stopTimer() {
+  return TCNT1;
+}
+
+template<class T> void benchmark(const __FlashStringHelper *type, const T value) {
+  corePrint.clear();
+  streamPrint.clear();
+
+  noInterrupts();
+  startTimer();
+  corePrint.print(value);
+  uint16_t coreCycles = stopTimer();
+
+  startTimer();
+  streamPrint << value;
+  uint16_t streamCycles = stopTimer();
+  interrupts();
+
+  bool same = corePrint.equals(streamPrint);
+  if (!same) identical = false;
+
+  Serial << type << padLeft(value, 12) << F(": print() ") << padLeft(coreCycles, 6)
+         << F(" cycles, operator<< ") << padLeft(streamCycles, 6) << F(" cycles")
+         << (same ? F("\n") : F("  *** MISMATCH ***\n"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("------------------------------\n");
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+  Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
+
+  benchmark(F("uint8_t "), (uint8_t)7);
+  benchmark(F("uint8_t "), (uint8_t)255);
+  benchmark(F("int8_t  "), (int8_t)-128);
+  benchmark(F("uint16_t"), (uint16_t)1234);
+  benchmark(F("uint16_t"), (uint16_t)65535);
+  benchmark(F("int16_t "), (int16_t)-32768);
+  benchmark(F("uint32_t"), (uint32_t)99999UL);
+  benchmark(F("uint32_t"), (uint32_t)4294967295UL);
+  benchmark(F("int32_t "), (int32_t)-2147483647L);
+
+  Serial << (identical ? F("Output is byte-identical.\n") : F("*** Output differs! ***\n"));
+}
+
+void loop() {}
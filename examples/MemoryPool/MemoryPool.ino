@@ -0,0 +1,84 @@
+// NAME: MemoryPool.ino
+//
+// DESC: Benchmark of FixedPool against malloc() and free() in a churn loop,
+//       which keeps up to SLOTS messages alive and replaces them in random
+//       order. Shows the time per allocation and free and the fragmentation
+//       of the heap afterwards.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/MemoryPool.h>
+
+#define SLOTS   16
+#define ROUNDS  2000
+
+struct Message {
+  uint32_t time;
+  int16_t values[6];
+};
+
+FixedPool<Message, SLOTS> pool;
+Message *slots[SLOTS];
+
+uint32_t churnMalloc() {
+  randomSeed(42);
+  uint32_t start = micros();
+  for (uint16_t i=0; i<ROUNDS; i++) {
+    uint8_t n = random(SLOTS);
+    free(slots[n]);
+    // vary the size like String buffers do
+    slots[n] = (Message *)malloc(sizeof(Message) + random(16));
+  }
+  uint32_t duration = micros() - start;
+  for (uint8_t n=0; n<SLOTS; n++) {
+    free(slots[n]);
+    slots[n] = 0L;
+  }
+  return duration;
+}
+
+uint32_t churnPool() {
+  randomSeed(42);
+  uint32_t start = micros();
+  for (uint16_t i=0; i<ROUNDS; i++) {
+    uint8_t n = random(SLOTS);
+    pool.free(slots[n]);
+    random(16); // same number of random() calls as churnMalloc()
+    slots[n] = (Message *)pool.allocate();
+  }
+  uint32_t duration = micros() - start;
+  for (uint8_t n=0; n<SLOTS; n++) {
+    pool.free(slots[n]);
+    slots[n] = 0L;
+  }
+  return duration;
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+
+  uint32_t mallocTime = churnMalloc();
+  HeapStats heap = TrappmannRobotics::getHeapStats();
+  Serial << F("malloc/free: ") << mallocTime << F(" us for ") << ROUNDS << F(" rounds, heap fragments ")
+         << heap.fragments << F(", largest free ") << heap.largestFree << LF;
+
+  uint32_t poolTime = churnPool();
+  Serial << F("FixedPool:   ") << poolTime << F(" us for ") << ROUNDS << F(" rounds, ") << pool.getStats() << LF;
+  // both loops call random() equally often, which dominates the time
+  Serial << F("random():    ") << measureRandom() << F(" us\n");
+}
+
+uint32_t measureRandom() {
+  randomSeed(42);
+  uint32_t start = micros();
+  for (uint16_t i=0; i<ROUNDS; i++) {
+    random(SLOTS);
+    random(16);
+  }
+  return micros() - start;
+}
+
+void loop() {
+}
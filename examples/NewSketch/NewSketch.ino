@@ -10,22 +10,39 @@
 //
 
 #include <TrappmannRobotics.h>
-#include <TrappmannRobotics/System.h>
+#include <TrappmannRobotics_System.h>
+#include <TrappmannRobotics/BuildInfo.h>
+#include <TrappmannRobotics/LoopMonitor.h>
+
+// build time and hash of this Sketch in flash, see getBuildTimestamp()
+TRAPPMANNROBOTICS_BUILD_INFO;
+
+// time of the boot phases up to the end of setup()
+TRAPPMANNROBOTICS_BOOT_PROFILE;
+
+// duration of each loop() pass, send '?' to show it
+LoopMonitor loopMonitor;
 
 void setup() {
+  System::markSetupBegin();
   pinMode(LED_PIN, OUTPUT);
   
   Serial.begin(115200);
   while (!Serial);
   Serial << F("------------------------------\n");
-  Serial << F("Sketch: ") << getBaseName(__FILE__) << LF;
-  Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+  Serial << F("Uploaded: ") << TrappmannRobotics::getBuildTimestamp() << LF;
   Serial << F("Free Memory: ") << TrappmannRobotics::getFreeMemory() << F(" bytes\n");
   Serial << F("Reset Flags: 0b") << toBinaryString(System::getResetFlags()) << LF;
+  System::markSetupDone();
+  System::printBootProfile(Serial);
   Serial << F("Running...\n");
 }
 
 void loop() {
+  loopMonitor.tick();
+  if (Serial.available() && ('?' == Serial.read())) loopMonitor.dump(Serial);
+
   static bool state = false;
   if (state) {
     digitalWrite(LED_PIN, LOW);
@@ -0,0 +1,45 @@
+// NAME: Probes.ino
+//
+// DESC: Measures the parts of a control loop in CPU cycles with timing probes.
+//       Remove the define of PROBES_ENABLED and the probes compile to nothing.
+//
+
+#define PROBES_ENABLED
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/Probe.h>
+
+int16_t readSensor() {
+  PROBE("readSensor");
+  return analogRead(A0);
+}
+
+float controller(int16_t value) {
+  PROBE_HISTOGRAM("controller");
+  static float integral = 0;
+  float error = 512 - value;
+  integral += error * 0.01;
+  return 0.8 * error + integral;
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+
+  beginProbes();
+}
+
+void loop() {
+  static uint16_t count = 0;
+  {
+    PROBE("control loop");
+    float output = controller(readSensor());
+    analogWrite(3, constrain(output, 0, 255));
+  }
+
+  if (++count == 1000) {
+    dumpProbes(Serial);
+    resetProbes();
+    count = 0;
+  }
+}
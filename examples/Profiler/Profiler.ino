@@ -0,0 +1,46 @@
+// NAME: Profiler.ino
+//
+// DESC: Finds the hot spots of a Sketch with the sampling profiler. Every 5s
+//       the histogram is sent as binary frames. Show the report on the host
+//       with:
+//         python3 extras/profile.py Profiler.ino.elf <port> 115200
+//       The ELF file is found in the build folder of the Arduino IDE.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/Profiler.h>
+
+volatile float result;
+
+void slowFloatMath() {
+  for (uint8_t i=0; i<50; i++) {
+    result = sqrt(result + i) * 1.5;
+  }
+}
+
+void fastIntegerMath() {
+  volatile uint16_t sum = 0;
+  for (uint8_t i=0; i<50; i++) {
+    sum += i;
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+
+  Profiler::begin(1000); // 1000 samples per second
+}
+
+void loop() {
+  static uint32_t lastDump = 0;
+
+  slowFloatMath();
+  fastIntegerMath();
+
+  if (millis() - lastDump >= 5000) {
+    lastDump = millis();
+    Profiler::dump(Serial);
+    Profiler::clear();
+  }
+}
@@ -0,0 +1,41 @@
+// NAME: ResetHistory.ino
+//
+// DESC: Keeps the history of the resets in a wear leveled log in the EEPROM
+//       and shows how often the board was reset by brown-out or watchdog.
+//       Send 'c' to clear the log.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics_System.h>
+#include <TrappmannRobotics/ResetLog.h>
+
+// 32 records of 11 bytes behind the SystemConfig
+ResetLog resetLog(64, 32);
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+
+  resetLog.begin();
+  resetLog.logBoot();
+  System::clearCrashRecord();
+
+  Serial << F("Reset history:\n");
+  resetLog.print(Serial);
+  Serial << F("brown-out resets: ") << resetLog.countByFlag(1<<BORF) << LF;
+  Serial << F("watchdog resets:  ") << resetLog.countByFlag(1<<WDRF) << LF;
+}
+
+void loop() {
+  static uint32_t lastUpdate = 0;
+  if (millis() - lastUpdate >= 3600000UL) { // once an hour, see updateUptime()
+    lastUpdate = millis();
+    resetLog.updateUptime();
+  }
+
+  if (Serial.available() && ('c' == Serial.read())) {
+    resetLog.clear();
+    Serial << F("Reset history cleared\n");
+  }
+}
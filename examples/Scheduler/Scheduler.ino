@@ -0,0 +1,54 @@
+// NAME: Scheduler.ino
+//
+// DESC: Runs periodic tasks with the cooperative scheduler instead of delay().
+//       The watchdog is only reset, while all tasks run within their deadline.
+//       Every 5s the run time and lateness of the tasks is printed.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/Watchdog.h>
+#include <TrappmannRobotics/Scheduler.h>
+
+Scheduler<4> scheduler;
+int16_t sensorValue = 0;
+
+void blink() {
+  digitalWrite(LED_PIN, !digitalRead(LED_PIN));
+}
+
+void readSensor() {
+  sensorValue = analogRead(A0);
+}
+
+void echoSerial() {
+  while (Serial.available()) {
+    Serial.write(Serial.read());
+  }
+}
+
+void printStats() {
+  Serial << F("sensor=") << sensorValue << LF;
+  scheduler.dump(Serial);
+  scheduler.resetStats();
+}
+
+void setup() {
+  Watchdog::watchdogOff();
+  pinMode(LED_PIN, OUTPUT);
+
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+
+  scheduler.addTask(blink, 500);
+  scheduler.addTask(readSensor, 10, 0, 100); // must run at least every 100ms
+  scheduler.addTask(echoSerial, 50, 5);
+  scheduler.addTask(printStats, 5000, 7);
+
+  Watchdog::watchdogOn(WDTO_1s, 0L);
+  scheduler.useWatchdog();
+}
+
+void loop() {
+  scheduler.run();
+}
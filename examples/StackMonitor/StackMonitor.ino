@@ -0,0 +1,46 @@
+// NAME: StackMonitor.ino
+//
+// DESC: Measures the stack usage of each part of a Sketch by stack painting
+//       and keeps track of the minimum free RAM while running.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/StackMonitor.h>
+
+// paint the free RAM at startup to measure the stack usage since the reset
+TRAPPMANNROBOTICS_STACK_PAINT;
+
+// recursive function as example for a deep stack
+uint16_t sum(uint8_t n) {
+  volatile uint8_t buffer[8];
+  buffer[0] = n;
+  return (0 == n) ? 0 : buffer[0] + sum(n - 1);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+  Serial << F("Stack headroom after startup: ") << StackMonitor::getStackHeadroom() << F(" bytes\n");
+
+  // measure each subsystem on its own
+  uint16_t headroom;
+  StackMonitor::repaint();
+  sum(10);
+  headroom = StackMonitor::getStackHeadroom();
+  Serial << F("sum(10): max. stack usage ") << StackMonitor::getMaxStackUsage() << F(" bytes, headroom ") << headroom << F(" bytes\n");
+
+  StackMonitor::repaint();
+  sum(40);
+  headroom = StackMonitor::getStackHeadroom();
+  Serial << F("sum(40): max. stack usage ") << StackMonitor::getMaxStackUsage() << F(" bytes, headroom ") << headroom << F(" bytes\n");
+}
+
+void loop() {
+  // scan a few words in each loop, so loop() is never blocked for long
+  if (StackMonitor::scanStep()) {
+    Serial << F("min. headroom: ") << StackMonitor::getMinHeadroom() << F(" bytes\n");
+  }
+  sum(random(50));
+  delay(100);
+}
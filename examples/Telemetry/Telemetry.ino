@@ -0,0 +1,61 @@
+// NAME: Telemetry.ino
+//
+// DESC: Streams sensor frames at 100 Hz as JSON or CSV to Serial.
+//       Send 'j' for JSON and 'c' for CSV output.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/JsonPrint.h>
+#include <TrappmannRobotics/CsvPrint.h>
+
+#define FRAME_PERIOD_MS 10
+
+BufferedPrint<64> out(Serial);
+bool jsonMode = true;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+  Serial << F("------------------------------\n");
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
+  Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
+}
+
+void sendJson(uint32_t now, int x, int y, int z) {
+  JsonPrint json(out);
+  json.beginObject()
+        .member(F("time"), now)
+        .key(F("acc")).beginArray().value(x).value(y).value(z).endArray()
+        .member(F("free"), TrappmannRobotics::getFreeMemory())
+      .endObject();
+}
+
+void sendCsv(uint32_t now, int x, int y, int z) {
+  CsvPrint csv(out);
+  csv << now << x << y << z << TrappmannRobotics::getFreeMemory() << CsvPrint::endRow;
+}
+
+void loop() {
+  static uint32_t lastFrame = 0;
+
+  if (Serial.available()) {
+    char c = Serial.read();
+    if ('j' == c) jsonMode = true;
+    if ('c' == c) {
+      jsonMode = false;
+      CsvPrint csv(out);
+      csv << F("time") << F("x") << F("y") << F("z") << F("free") << CsvPrint::endRow;
+    }
+  }
+
+  uint32_t now = millis();
+  if (now - lastFrame >= FRAME_PERIOD_MS) {
+    lastFrame += FRAME_PERIOD_MS;
+
+    int x = analogRead(A0);
+    int y = analogRead(A1);
+    int z = analogRead(A2);
+    if (jsonMode) sendJson(now, x, y, z);
+    else sendCsv(now, x, y, z);
+  }
+}
@@ -0,0 +1,25 @@
+// NAME: TokenLog.ino
+//
+// DESC: Tokenized logging: the format strings stay on the host, only their
+//       IDs and the binary arguments are sent. Decode the output with:
+//         python3 extras/tokenlog.py decode TokenLog.ino.elf <port> 115200
+//       The ELF file is found in the build folder of the Arduino IDE.
+//
+
+#include <TrappmannRobotics.h>
+#include <TrappmannRobotics/TokenLog.h>
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+
+  TokenLog::begin(Serial);
+  TLOG("free memory: %lu bytes", TrappmannRobotics::getFreeMemory());
+}
+
+void loop() {
+  const uint32_t now = millis();
+  const int16_t value = analogRead(A0);
+  TLOG("time=%lu ms, A0=%d, voltage=%.2f V", now, value, value * 5.0f / 1023);
+  delay(100);
+}
@@ -9,8 +9,11 @@
 #include <TrappmannRobotics/System.h>
 #include <TrappmannRobotics/SystemConfig.h>
 #include <TrappmannRobotics/SketchConfiguration.h>
+#include <TrappmannRobotics/HexDump.h>
+#include <TrappmannRobotics/LogBuffer.h>
 
 SketchConfiguration<SystemConfig> sysconfig;
+LogBuffer<128> logBuffer; // log sink for loop(), drained without blocking
 
 void setup() {
   Watchdog::watchdogOff();
@@ -18,7 +21,7 @@ void setup() {
   Serial.begin(115200);
   while (!Serial);
   Serial << F("------------------------------\n");
-  Serial << F("Sketch: ") << getBaseName(__FILE__) << LF;
+  Serial << F("Sketch: ") << SKETCH_NAME << LF;
   Serial << F("Uploaded: ") << TrappmannRobotics::getUploadTimestamp() << LF;
   Serial << F("Reset Flags: 0b") << toBinaryString(System::getResetFlags()) << LF;
 
@@ -39,6 +42,19 @@ void setup() {
   Serial << F("Checking for Watchdog-Reset... ");
   if (System::isResetByWatchdog()) {
     Serial << F("yes\n");
+
+    // the callback only captured the crash in RAM, now there is time to save it
+    if (System::hasCrashRecord()) {
+      System::printCrashRecord(Serial);
+      if (!sysconfig.loadConfig(MAGIC_SYSTEMCONFIG)) sysconfig.data.init();
+      const CrashRecord& crash = System::getCrashRecord();
+      sysconfig.data.resetCounter++;
+      sysconfig.data.freeMemoryAtIRQ = crash.freeMemory;
+      sysconfig.data.programCounterAtIRQ = crash.pc;
+      sysconfig.data.timeAtIRQ = crash.millis;
+      sysconfig.saveConfig(MAGIC_SYSTEMCONFIG);
+      System::clearCrashRecord();
+    }
     
     if (sysconfig.loadConfig(MAGIC_SYSTEMCONFIG)) {
       Serial << F("Watchdog-Counter       = ") << sysconfig.data.resetCounter << LF;
@@ -78,22 +94,17 @@ void setup() {
 }
 
 void dumpEEPROM(Print& out) {
-  out.print("SystemConfig: ");
-  for (int i=0; i<sizeof(sysconfig); i++) {
-    uint8_t value;
-    EEPROM.get(EEPROM_CONFIG_ADDR+i, value);
-    String buffer = "0" + String(value, HEX);
-    out.print(buffer.substring(buffer.length()-2));
-    out.print(" ");
-  }
-  out.println();
+  out.print("SystemConfig:\n");
+  hexDump(out, HEXDUMP_EEPROM, EEPROM_CONFIG_ADDR, sizeof(sysconfig));
 }
 
 int count = 0;
 void loop() {
   Watchdog::watchdogReset();  // Zähler zurücksetzen
 
-  Serial << F("loop #") << (++count) << LF;
+  logBuffer << F("loop #") << (++count) << LF;
+  System::setCrashTag(count);
+  logBuffer.drain(Serial, Serial.availableForWrite());
   delay(1500);  // wati for watchdog
 
   Watchdog::watchdogOff();
@@ -105,18 +116,10 @@ void loop() {
 
 /*   
  * This callback function is called from the Watchdog ISR.
- * It should not contain any blocking function calls.
+ * It must not contain any blocking function calls like serial output. The crash
+ * is captured in the .noinit RAM within a few microseconds and is printed and
+ * saved to the EEPROM from setup() after the reset.
  */
 void watchdogCallback(uint32_t irqPC) {
-  Serial << F("*** ISR Watchdog-Callback, time=") << millis() << ", PC=0x"; Serial.println(irqPC, HEX);
-
-  // save config data
-  sysconfig.data.resetCounter++;
-  sysconfig.data.freeMemoryAtIRQ = TrappmannRobotics::getFreeMemory();
-  sysconfig.data.programCounterAtIRQ = irqPC;
-  sysconfig.data.timeAtIRQ = millis();
-  sysconfig.saveConfig(MAGIC_SYSTEMCONFIG);
-  
-  Serial.println("ISR done.");
-  Serial.flush();
+  System::captureCrash(irqPC);
 }
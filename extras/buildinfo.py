@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# NAME: buildinfo.py
+#
+# DESC: Shows the BuildInfo record of a firmware image of the
+#       TrappmannRobotics-Library without running it. The record is found by
+#       its magic in an Intel HEX file (ie. read back by avrdude), a binary
+#       image or the ELF file of the Sketch. In the flash image it starts right
+#       behind the interrupt vectors, at BUILDINFO_ADDRESS.
+#
+# USAGE: buildinfo.py <image.hex|image.bin|sketch.elf> [sketch name]
+#        With the file name of the Sketch, ie. Blink.ino, its hash is checked.
+#        The hash is built from __FILE__, which is the .ino file because of
+#        the #line directives of the Arduino build. A path is reduced to the
+#        file name.
+#
+# This file is part of the TrappmannRobotics-Library for the Arduino environment.
+# https://github.com/ATrappmann/TrappmannRobotics-Library
+#
+# MIT License
+#
+# Copyright (c) 2026 Andreas Trappmann
+#
+import os
+import struct
+import sys
+
+BUILDINFO_MAGIC = b'TRBI'
+# version 1: magic, version, size, timestamp, library version, sketch hash, gcc version, image end
+BUILDINFO_FORMAT = '<4sBB21s9sI3BH'
+
+
+def read_hex(path):
+    """Return the flash image of an Intel HEX file."""
+    image = bytearray()
+    base = 0
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith(':'):
+                continue
+            record = bytes.fromhex(line[1:])
+            count, address, kind = record[0], struct.unpack('>H', record[1:3])[0], record[3]
+            data = record[4:4 + count]
+            if kind == 0:
+                end = base + address + count
+                if len(image) < end:
+                    image += b'\xff' * (end - len(image))
+                image[base + address:end] = data
+            elif kind == 2:
+                base = struct.unpack('>H', data)[0] << 4
+            elif kind == 4:
+                base = struct.unpack('>H', data)[0] << 16
+    return bytes(image)
+
+
+def fnv1a(name):
+    value = 2166136261
+    for c in name.encode():
+        value = ((value ^ c) * 16777619) & 0xffffffff
+    return value
+
+
+def main(argv):
+    if len(argv) < 2:
+        print('usage: buildinfo.py <image.hex|image.bin|sketch.elf> [sketch name]', file=sys.stderr)
+        return 1
+    if argv[1].lower().endswith('.hex'):
+        image = read_hex(argv[1])
+    else:
+        with open(argv[1], 'rb') as f:
+            image = f.read()
+
+    # the magic may also be found in code, so check version and size
+    size = struct.calcsize(BUILDINFO_FORMAT)
+    pos = image.find(BUILDINFO_MAGIC)
+    while pos >= 0:
+        if pos + size <= len(image) and image[pos + 4] >= 1 and image[pos + 5] >= size:
+            timestamp = image[pos + 6:pos + 27]
+            if timestamp[20] == 0 and all(32 <= c < 127 for c in timestamp[:20]):
+                break
+        pos = image.find(BUILDINFO_MAGIC, pos + 1)
+    if pos < 0:
+        print('no BuildInfo record found', file=sys.stderr)
+        return 1
+    (_, version, record_size, timestamp, library, sketch_hash,
+     major, minor, patch, image_end) = struct.unpack_from(BUILDINFO_FORMAT, image, pos)
+    print('Offset:   0x%04x' % pos)
+    print('Version:  %d' % version)
+    print('Build:    %s' % timestamp.split(b'\0')[0].decode())
+    print('Library:  %s' % library.split(b'\0')[0].decode())
+    print('Sketch:   0x%08x' % sketch_hash)
+    print('Compiler: avr-gcc %d.%d.%d' % (major, minor, patch))
+    print('Image:    %d bytes' % image_end)
+    if len(argv) > 2:
+        name = os.path.basename(argv[2])
+        match = fnv1a(name) == sketch_hash
+        print('Sketch %s: %s' % (name, 'match' if match else 'MISMATCH'))
+        return 0 if match else 2
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
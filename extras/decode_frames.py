@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# NAME: decode_frames.py
+#
+# DESC: Host side decoder for the binary telemetry frames of the class
+#       BinaryFrame of the TrappmannRobotics-Library. Reads COBS encoded
+#       frames from a serial port or a file, checks the CRC-16 and prints
+#       the typed fields of every frame as one line of text.
+#
+# USAGE: decode_frames.py <port|file|-> [baudrate]
+#        Reading from a serial port requires pyserial (pip install pyserial).
+#
+# This file is part of the TrappmannRobotics-Library for the Arduino environment.
+# https://github.com/ATrappmann/TrappmannRobotics-Library
+#
+# MIT License
+#
+# Copyright (c) 2026 Andreas Trappmann
+#
+import struct
+import sys
+
+# field type -> (struct format, size), see enum FrameFieldType
+FIELD_TYPES = {
+    0: ('<B', 1),   # FIELD_U8
+    1: ('<b', 1),   # FIELD_I8
+    2: ('<H', 2),   # FIELD_U16
+    3: ('<h', 2),   # FIELD_I16
+    4: ('<I', 4),   # FIELD_U32
+    5: ('<i', 4),   # FIELD_I32
+    6: ('<f', 4),   # FIELD_FLOAT
+}
+
+
+def crc16(data, crc=0xffff):
+    """CRC-16/CCITT with polynomial 0x1021, same as Crc16.cpp."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xffff
+    return crc
+
+
+def cobs_decode(data):
+    """Decode a COBS encoded frame without the zero delimiter."""
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        code = data[pos]
+        if code == 0 or pos + code > len(data) + 1:
+            raise ValueError('invalid COBS code')
+        out += data[pos + 1:pos + code]
+        pos += code
+        if code < 0xff and pos < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def check_frame(frame):
+    """Verify the CRC and return the frame without it."""
+    if len(frame) < 3:
+        raise ValueError('frame too short')
+    payload, crc = frame[:-2], struct.unpack('<H', frame[-2:])[0]
+    if crc16(payload) != crc:
+        raise ValueError('CRC mismatch')
+    return payload
+
+
+def parse_fields(payload):
+    """Return frame type and list of (id, value) of a checked frame."""
+    frame_type = payload[0]
+    fields = []
+    pos = 1
+    while pos < len(payload):
+        header = payload[pos]
+        fmt, size = FIELD_TYPES[header >> 5]
+        value = struct.unpack(fmt, payload[pos + 1:pos + 1 + size])[0]
+        fields.append((header & 0x1f, value))
+        pos += 1 + size
+    return frame_type, fields
+
+
+def read_frames(stream):
+    """Yield the COBS encoded frames read from a binary stream."""
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            return
+        if chunk[0] == 0:
+            if buffer:
+                yield bytes(buffer)
+            buffer.clear()
+        else:
+            buffer += chunk
+
+
+def open_input(name, baudrate):
+    if name == '-':
+        return sys.stdin.buffer
+    if name.startswith('/dev/') or name.upper().startswith('COM'):
+        import serial
+        return serial.Serial(name, baudrate)
+    return open(name, 'rb')
+
+
+def main(argv):
+    if len(argv) < 2:
+        print('usage: decode_frames.py <port|file|-> [baudrate]', file=sys.stderr)
+        return 1
+    baudrate = int(argv[2]) if len(argv) > 2 else 115200
+    errors = 0
+    for encoded in read_frames(open_input(argv[1], baudrate)):
+        try:
+            frame_type, fields = parse_fields(check_frame(cobs_decode(encoded)))
+        except (ValueError, KeyError, struct.error) as e:
+            errors += 1
+            print('# invalid frame (%s), %d errors' % (e, errors), file=sys.stderr)
+            continue
+        print('type=%d ' % frame_type + ' '.join('%d=%s' % field for field in fields), flush=True)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,34 @@
+// NAME: malloc_count.cpp
+//
+// DESC: Replaces the allocation functions of the C library with versions
+//       which count the calls and pass them on to glibc.
+//
+#include "malloc_count.h"
+#include <stddef.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+static unsigned long allocations = 0;
+
+void *malloc(size_t size) {
+  allocations++;
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+  allocations++;
+  return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  allocations++;
+  return __libc_realloc(ptr, size);
+}
+}
+
+unsigned long mallocCount() {
+  return allocations;
+}
@@ -0,0 +1,12 @@
+// NAME: malloc_count.h
+//
+// DESC: Counts the calls of malloc(), calloc() and realloc() on the host, so a
+//       test can prove that a function does not touch the heap.
+//
+#ifndef MALLOC_COUNT_H
+#define MALLOC_COUNT_H
+
+// Number of allocations since the start of the program.
+unsigned long mallocCount();
+
+#endif /* MALLOC_COUNT_H */
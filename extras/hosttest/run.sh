@@ -0,0 +1,16 @@
+#!/bin/sh
+# NAME: run.sh
+#
+# DESC: Builds and runs the host tests of the library with the C++ compiler of
+#       the host, ie. ./extras/hosttest/run.sh
+#
+set -e
+DIR=$(cd "$(dirname "$0")" && pwd)
+SRC="$DIR/../../src"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+${CXX:-g++} -std=gnu++11 -Wall -O1 -I"$DIR/stub" -I"$SRC" \
+	"$DIR/test_formatters.cpp" "$DIR/malloc_count.cpp" "$SRC/TrappmannRobotics_StringHelper.cpp" \
+	-o "$OUT/test_formatters"
+"$OUT/test_formatters"
@@ -0,0 +1,16 @@
+// NAME: Arduino.h
+//
+// DESC: Minimal host replacement of the Arduino core for the host tests.
+//
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <Print.h>
+#include <Stream.h>
+#include <WString.h>
+#include <avr/pgmspace.h>
+
+#define LED_BUILTIN	13
+
+#endif /* ARDUINO_H */
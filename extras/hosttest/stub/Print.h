@@ -0,0 +1,76 @@
+// NAME: Print.h
+//
+// DESC: Host version of the Arduino Print class with the methods used by the
+//       library.
+//
+#ifndef PRINT_H
+#define PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <WString.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+private:
+  int writeError;
+
+protected:
+  void setWriteError(int err = 1) { writeError = err; }
+
+public:
+  Print() : writeError(0) {}
+  virtual ~Print() {}
+  int getWriteError() { return writeError; }
+  void clearWriteError() { setWriteError(0); }
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+	size_t n = 0;
+	while (size-- && write(*buffer++)) n++;
+	return n;
+  }
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper *str) { return write((const char *)str); }
+  size_t print(const String &str) { return write(str.c_str(), str.length()); }
+  size_t print(const char str[]) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC) {
+	if ((DEC == base) && (n < 0)) return print('-') + printNumber(0UL - (unsigned long)n, DEC);
+	return printNumber(n, base);
+  }
+  size_t print(unsigned long n, int base = DEC) { return printNumber(n, base); }
+  size_t print(double d, int digits = 2) {
+	char buf[40];
+	snprintf(buf, sizeof(buf), "%.*f", digits, d);
+	return write(buf);
+  }
+  size_t println() { return write("\r\n"); }
+
+private:
+  size_t printNumber(unsigned long n, uint8_t base) {
+	char buf[8 * sizeof(long) + 1];
+	char *str = &buf[sizeof(buf) - 1];
+	*str = '\0';
+	do {
+	  const char c = n % base;
+	  n /= base;
+	  *--str = (c < 10) ? c + '0' : c + 'A' - 10;
+	} while (n);
+	return write(str);
+  }
+};
+
+#endif /* PRINT_H */
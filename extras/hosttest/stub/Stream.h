@@ -0,0 +1,17 @@
+// NAME: Stream.h
+//
+// DESC: Host version of the Arduino Stream class.
+//
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <Print.h>
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+#endif /* STREAM_H */
@@ -0,0 +1,58 @@
+// NAME: WString.h
+//
+// DESC: Host version of the Arduino String class. Like the original, it keeps
+//       its characters on the heap with malloc() and realloc(), so the host
+//       tests can count its allocations.
+//
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include <stdlib.h>
+#include <string.h>
+
+class __FlashStringHelper;
+#define F(s)	((const __FlashStringHelper *)(s))
+
+class String {
+private:
+  char *buffer;
+  unsigned int len;
+  unsigned int capacity;
+
+public:
+  String(const char *str = "") : buffer(0L), len(0), capacity(0) { copy(str, strlen(str)); }
+  String(const String &other) : buffer(0L), len(0), capacity(0) { copy(other.buffer, other.len); }
+  ~String() { free(buffer); }
+  String& operator=(const String &other) { if (this != &other) copy(other.buffer, other.len); return *this; }
+
+  bool reserve(unsigned int size) {
+	if (buffer && (capacity >= size)) return true;
+	char *p = (char *)realloc(buffer, size + 1);
+	if (!p) return false;
+	if (!buffer) p[0] = '\0';
+	buffer = p;
+	capacity = size;
+	return true;
+  }
+  String& operator+=(const char c) {
+	if (reserve(len + 1)) {
+	  buffer[len++] = c;
+	  buffer[len] = '\0';
+	}
+	return *this;
+  }
+  bool operator==(const char *str) const { return 0 == strcmp(c_str(), str); }
+
+  const char *c_str() const { return buffer ? buffer : ""; }
+  unsigned int length() const { return len; }
+
+private:
+  void copy(const char *str, const unsigned int size) {
+	if (!reserve(size)) return;
+	memcpy(buffer, str, size);
+	buffer[size] = '\0';
+	len = size;
+  }
+};
+
+#endif /* WSTRING_H */
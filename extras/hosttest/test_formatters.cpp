@@ -0,0 +1,68 @@
+// NAME: test_formatters.cpp
+//
+// DESC: Checks the results of the hex and binary formatters and that they do
+//       not allocate any memory on the heap. The String returning functions
+//       must get along with a single allocation.
+//
+#include <TrappmannRobotics_StringHelper.h>
+#include "malloc_count.h"
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// Collects the output in a fixed buffer without allocation.
+class BufferPrint : public Print {
+public:
+  char text[64];
+  size_t len;
+  BufferPrint() : len(0) { text[0] = '\0'; }
+  size_t write(uint8_t c) {
+	if (len + 1 >= sizeof(text)) return 0;
+	text[len++] = c;
+	text[len] = '\0';
+	return 1;
+  }
+};
+
+static void testFormatters() {
+  char buf[33];
+  const unsigned long before = mallocCount();
+
+  formatHex(buf, 0xab, 2);
+  CHECK(0 == strcmp(buf, "ab"));
+  formatHex(buf, 0x1234abcdUL, 8);
+  CHECK(0 == strcmp(buf, "1234abcd"));
+  formatBin(buf, 5, 8);
+  CHECK(0 == strcmp(buf, "00000101"));
+  CHECK(0 == strcmp(toHexBuf((uint16_t)0x3f).str, "003f"));
+  CHECK(0 == strcmp(toBinaryBuf((uint8_t)3).str, "00000011"));
+
+  BufferPrint out;
+  out << toHexBuf((uint8_t)0x07) << ' ' << toBinaryBuf((uint8_t)0x81) << ' ' << hex32(0xdeadbeefUL);
+  CHECK(0 == strcmp(out.text, "07 10000001 deadbeef"));
+
+  CHECK(mallocCount() == before);
+}
+
+static void testStringFunctions() {
+  const unsigned long before = mallocCount();
+  {
+	const String hex = toHexString((uint32_t)0xdead);
+	CHECK(hex == "0000dead");
+  }
+  CHECK(mallocCount() - before == 1);
+}
+
+int main() {
+  testFormatters();
+  testStringFunctions();
+  if (failures) {
+	printf("%d check(s) failed\n", failures);
+	return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# NAME: profile.py
+#
+# DESC: Host side report for the sampling profiler of the class Profiler of
+#       the TrappmannRobotics-Library. Reads the histogram frames sent by
+#       Profiler::dump() and maps the address buckets to the symbols of the
+#       Sketch, using the output of avr-nm. With --lines the start address of
+#       the hottest buckets is shown as source line by avr-addr2line.
+#
+# USAGE: profile.py [--nm <file>] [--lines] [--top <n>] <elf> <port|file|-> [baudrate]
+#        The ELF file is found in the build folder of the Arduino IDE. Instead
+#        of running avr-nm, its output (avr-nm -n -S -C <elf>) can be given
+#        by --nm.
+#
+# This file is part of the TrappmannRobotics-Library for the Arduino environment.
+# https://github.com/ATrappmann/TrappmannRobotics-Library
+#
+# MIT License
+#
+# Copyright (c) 2026 Andreas Trappmann
+#
+import argparse
+import struct
+import subprocess
+import sys
+
+from decode_frames import check_frame, cobs_decode, open_input, read_frames
+
+PROFILER_FRAME_TYPE = 0xfd
+
+
+def read_symbols(lines):
+    """Return the sorted list of (address, size, name) of the code symbols."""
+    symbols = []
+    for line in lines:
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in 'tTwW':
+            symbols.append((int(parts[0], 16), int(parts[1], 16), parts[3].strip()))
+        elif len(parts) == 3 and parts[1] in 'tTwW':
+            symbols.append((int(parts[0], 16), 0, parts[2].strip()))
+    symbols.sort()
+    # symbols without size reach up to the next symbol
+    for i, (address, size, name) in enumerate(symbols):
+        if size == 0 and i + 1 < len(symbols):
+            symbols[i] = (address, symbols[i + 1][0] - address, name)
+    return symbols
+
+
+def attribute(buckets, bucket_size, symbols):
+    """Split the count of each bucket between the symbols by their overlap."""
+    counts = {}
+    for index, count in enumerate(buckets):
+        if count == 0:
+            continue
+        start, end = index * bucket_size, (index + 1) * bucket_size
+        overlaps = [(min(end, a + s) - max(start, a), name) for a, s, name in symbols
+                    if a < end and a + s > start]
+        total = sum(size for size, _ in overlaps)
+        if total == 0:
+            counts['<unknown>'] = counts.get('<unknown>', 0) + count
+            continue
+        for size, name in overlaps:
+            counts[name] = counts.get(name, 0) + count * size / total
+    return counts
+
+
+def source_line(elf, address):
+    try:
+        out = subprocess.run(['avr-addr2line', '-f', '-C', '-e', elf, '0x%x' % address],
+                             capture_output=True, text=True, check=True).stdout.split('\n')
+        return '%s %s' % (out[0], out[1])
+    except (OSError, subprocess.CalledProcessError):
+        return ''
+
+
+def report(args, symbols, shift, buckets):
+    bucket_size = 2 << shift
+    samples = sum(buckets)
+    print('# %d samples, %d buckets of %d bytes' % (samples, len(buckets), bucket_size))
+    if samples == 0:
+        return
+    counts = attribute(buckets, bucket_size, symbols)
+    for name, count in sorted(counts.items(), key=lambda item: -item[1])[:args.top]:
+        print('%6.2f%% %8.1f  %s' % (100.0 * count / samples, count, name))
+    if args.lines:
+        print('# hottest buckets')
+        hottest = sorted(range(len(buckets)), key=lambda i: -buckets[i])[:args.top]
+        for index in hottest:
+            if buckets[index]:
+                print('0x%05x %6d  %s' % (index * bucket_size, buckets[index],
+                                          source_line(args.elf, index * bucket_size)))
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Map Profiler histograms to symbols.')
+    parser.add_argument('--nm', help='output of avr-nm -n -S -C instead of running avr-nm')
+    parser.add_argument('--lines', action='store_true', help='show source lines of the hottest buckets')
+    parser.add_argument('--top', type=int, default=20, help='number of lines to show')
+    parser.add_argument('elf')
+    parser.add_argument('input')
+    parser.add_argument('baudrate', type=int, nargs='?', default=115200)
+    args = parser.parse_args()
+
+    if args.nm:
+        with open(args.nm) as f:
+            symbols = read_symbols(f)
+    else:
+        nm = subprocess.run(['avr-nm', '-n', '-S', '-C', '--defined-only', args.elf],
+                            capture_output=True, text=True, check=True)
+        symbols = read_symbols(nm.stdout.splitlines())
+
+    buckets = None
+    for encoded in read_frames(open_input(args.input, args.baudrate)):
+        try:
+            payload = check_frame(cobs_decode(encoded))
+        except ValueError as e:
+            print('# invalid frame (%s)' % e, file=sys.stderr)
+            continue
+        if payload[0] != PROFILER_FRAME_TYPE or len(payload) < 4:
+            continue
+        shift, count, first = payload[1], payload[2], payload[3]
+        values = struct.unpack('<%dH' % ((len(payload) - 4) // 2), payload[4:4 + (len(payload) - 4) // 2 * 2])
+        if first == 0:
+            buckets = [0] * count
+        if buckets is None:
+            continue
+        buckets[first:first + len(values)] = values
+        if first + len(values) >= count:
+            report(args, symbols, shift, buckets)
+            buckets = None
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
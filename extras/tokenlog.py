@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# NAME: tokenlog.py
+#
+# DESC: Host side decoder for the tokenized logging of the class TokenLog of
+#       the TrappmannRobotics-Library. The format strings of all TLOG()
+#       statements are read from the section .trlog of the ELF file of the
+#       sketch, the ID of a string is its offset within this section.
+#
+# USAGE: tokenlog.py table <elf>
+#            Print the table of format strings as JSON.
+#        tokenlog.py decode <elf|json> <port|file|-> [baudrate]
+#            Decode the log records and print them as text. Frames of other
+#            types are printed like decode_frames.py does.
+#
+# This file is part of the TrappmannRobotics-Library for the Arduino environment.
+# https://github.com/ATrappmann/TrappmannRobotics-Library
+#
+# MIT License
+#
+# Copyright (c) 2026 Andreas Trappmann
+#
+import json
+import re
+import struct
+import sys
+
+from decode_frames import check_frame, cobs_decode, open_input, parse_fields, read_frames
+
+TOKENLOG_FRAME_TYPE = 0xfe
+TOKENLOG_SECTION = '.trlog'
+
+# printf conversion specification
+FORMAT_SPEC = re.compile(r'%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l)?([diouxXcsfeEgGp%])')
+
+
+def read_section(path, name):
+    """Return the contents of a section of an ELF32 little endian file."""
+    with open(path, 'rb') as f:
+        elf = f.read()
+    if elf[:4] != b'\x7fELF' or elf[4] != 1 or elf[5] != 1:
+        raise ValueError('%s is no ELF32 little endian file' % path)
+    shoff, = struct.unpack_from('<I', elf, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x2e)
+    sections = [struct.unpack_from('<IIIIIIIIII', elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    for sh_name, _, _, _, offset, size, _, _, _, _ in sections:
+        end = elf.index(b'\0', strtab[4] + sh_name)
+        if elf[strtab[4] + sh_name:end].decode() == name:
+            return elf[offset:offset + size]
+    raise ValueError('no section %s in %s' % (name, path))
+
+
+def build_table(path):
+    """Map the offset of every format string to the string."""
+    data = read_section(path, TOKENLOG_SECTION)
+    table = {}
+    pos = 0
+    while pos < len(data):
+        end = data.index(b'\0', pos)
+        if end > pos:
+            table[pos] = data[pos:end].decode('latin-1')
+        pos = end + 1
+    return table
+
+
+def load_table(path):
+    if path.endswith('.json'):
+        with open(path) as f:
+            return {int(key): value for key, value in json.load(f).items()}
+    return build_table(path)
+
+
+def format_record(table, payload):
+    """Format a log record: 16-bit ID followed by the arguments."""
+    if len(payload) < 3:
+        raise ValueError('log record too short')
+    token, = struct.unpack_from('<H', payload, 1)
+    if token not in table:
+        return '<unknown token %d> %s' % (token, payload[3:].hex())
+    fmt = table[token]
+    data = payload[3:]
+    pos = 0
+    out = []
+    last = 0
+    for spec in FORMAT_SPEC.finditer(fmt):
+        out.append(fmt[last:spec.start()])
+        last = spec.end()
+        flags, width, precision, length, conversion = spec.groups()
+        if conversion == '%':
+            out.append('%')
+            continue
+        if pos >= len(data):
+            out.append('<truncated>')
+            break
+        if conversion == 's':
+            end = data.find(b'\0', pos)
+            if end < 0:
+                out.append('<truncated>')
+                break
+            value = data[pos:end].decode('latin-1')
+            pos = end + 1
+        elif conversion in 'feEgG':
+            value, = struct.unpack_from('<f', data, pos)
+            pos += 4
+        elif conversion == 'p':
+            value, = struct.unpack_from('<H', data, pos)
+            out.append('0x%04x' % value)
+            pos += 2
+            continue
+        else:
+            size = 4 if length in ('l', 'll') else 2
+            signed = conversion in 'di'
+            value = int.from_bytes(data[pos:pos + size], 'little', signed=signed)
+            pos += size
+            if conversion == 'c':
+                value &= 0xff
+        out.append(('%' + (flags or '') + (width or '') + ('.' + precision if precision else '') + conversion) % value)
+    else:
+        out.append(fmt[last:])
+    return ''.join(out)
+
+
+def main(argv):
+    if len(argv) == 3 and argv[1] == 'table':
+        print(json.dumps(build_table(argv[2]), indent=2))
+        return 0
+    if len(argv) < 4 or argv[1] != 'decode':
+        print('usage: tokenlog.py table <elf>\n'
+              '       tokenlog.py decode <elf|json> <port|file|-> [baudrate]', file=sys.stderr)
+        return 1
+    table = load_table(argv[2])
+    baudrate = int(argv[4]) if len(argv) > 4 else 115200
+    errors = 0
+    for encoded in read_frames(open_input(argv[3], baudrate)):
+        try:
+            payload = check_frame(cobs_decode(encoded))
+            if payload[0] == TOKENLOG_FRAME_TYPE:
+                line = format_record(table, payload)
+            else:
+                frame_type, fields = parse_fields(payload)
+                line = 'type=%d ' % frame_type + ' '.join('%d=%s' % field for field in fields)
+        except (ValueError, KeyError, struct.error) as e:
+            errors += 1
+            print('# invalid frame (%s), %d errors' % (e, errors), file=sys.stderr)
+            continue
+        print(line, flush=True)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
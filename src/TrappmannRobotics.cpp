@@ -28,13 +28,28 @@
 // SOFTWARE.
 //
 #include <TrappmannRobotics.h>
+#include <TrappmannRobotics/BuildInfo.h>
 
 const char *TrappmannRobotics::getUploadTimestamp() {
 	static const char *msg = __DATE__ " " __TIME__;
 	return msg;
 }
 
+/*
+ * The timestamp is kept in the BuildInfo record in flash instead of RAM.
+ */
+const __FlashStringHelper *TrappmannRobotics::getBuildTimestamp() {
 #if defined(__avr__)
+	return BuildInfo::getTimestamp();
+#else
+	return F(__DATE__ " " __TIME__);
+#endif
+}
+
+#if defined(__avr__)
+#include <stdlib.h>
+#include <avr/io.h>
+
 /*
  * Calculate free RAM on the heap which is available for dynamic memory allocation.
  * __brkval is a pointer to the end of heap space or 0, if nothing was allocated.
@@ -51,6 +66,66 @@ uint32_t TrappmannRobotics::getFreeMemory() {
 #endif
 }
 
+/*
+ * The avr-libc malloc() keeps the freed chunks in a list sorted by address.
+ * Each chunk starts with its size, followed by the data or the pointer to
+ * the next free chunk.
+ */
+struct __freelist {
+  size_t sz;
+  struct __freelist *nx;
+};
+extern struct __freelist *__flp;
+extern char *__brkval;
+
+static uint16_t heapHighWater = 0;
+
+static char *heapLimit() {
+  if (__malloc_heap_end) return __malloc_heap_end;
+  return (char *)SP - __malloc_margin;
+}
+
+HeapStats TrappmannRobotics::getHeapStats() {
+  HeapStats stats = { 0, 0, 0, 0, 0, 0, 0 };
+  char *top = __brkval ? __brkval : __malloc_heap_start;
+  for (struct __freelist *fp = __flp; fp; fp = fp->nx) {
+	stats.fragments++;
+	stats.freeListBytes += fp->sz;
+	if (fp->sz > stats.largestFree) stats.largestFree = fp->sz;
+  }
+
+  // a new chunk at the top of the heap needs two bytes for its size
+  char *limit = heapLimit();
+  if (limit > top + sizeof(size_t)) stats.topFree = limit - top - sizeof(size_t);
+  if (stats.topFree > stats.largestFree) stats.largestFree = stats.topFree;
+  stats.totalFree = stats.freeListBytes + stats.topFree;
+
+  stats.heapSize = top - __malloc_heap_start;
+  if (stats.heapSize > heapHighWater) heapHighWater = stats.heapSize;
+  stats.highWater = heapHighWater;
+  return stats;
+}
+
+/*
+ * Print every chunk of the heap with its address, size and state, ie.
+ * 0x0234 used 24
+ * 0x024e free 16
+ */
+void TrappmannRobotics::printHeapMap(Print &out) {
+  char *top = __brkval ? __brkval : __malloc_heap_start;
+  struct __freelist *fp = __flp;
+  for (char *p = __malloc_heap_start; p < top; p += sizeof(size_t) + ((struct __freelist *)p)->sz) {
+	const bool isFree = ((char *)fp == p);
+	if (isFree) fp = fp->nx;
+	out << F("0x") << hex16((uint16_t)(uintptr_t)p) << (isFree ? F(" free ") : F(" used ")) << ((struct __freelist *)p)->sz << '\n';
+  }
+  const HeapStats stats = getHeapStats();
+  out << F("0x") << hex16((uint16_t)(uintptr_t)top) << F(" top  ") << stats.topFree << '\n';
+  out << F("free ") << stats.totalFree << F(", largest ") << stats.largestFree
+	  << F(", fragments ") << stats.fragments << F(", heap ") << stats.heapSize
+	  << F(", high water ") << stats.highWater << '\n';
+}
+
 #if !defined(TEENSYDUINO)
 const uint32_t TrappmannRobotics::getProgramCounter() {
   // get program counter from stack
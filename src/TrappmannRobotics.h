@@ -34,18 +34,42 @@
 
 #include <TrappmannRobotics_StringHelper.h>
 
+// Version of the library. It can not be read from library.properties while
+// compiling, so bump it by hand together with the version there.
+#define TRAPPMANNROBOTICS_VERSION "1.3.1"
+
 // Arduino pin definitions
 #define LED_PIN LED_BUILTIN
 
+#if defined(__avr__)
+/*
+ * Result of walking the free list of the avr-libc malloc().
+ * The top of the heap is the free space between __brkval and the stack
+ * (minus __malloc_margin) or __malloc_heap_end.
+ */
+struct HeapStats {
+	uint16_t totalFree;		// free blocks plus top of the heap
+	uint16_t largestFree;	// largest possible allocation
+	uint16_t fragments;		// number of blocks in the free list
+	uint16_t freeListBytes;	// free bytes inside the heap
+	uint16_t topFree;		// free bytes above the heap
+	uint16_t heapSize;		// current size of the heap
+	uint16_t highWater;		// maximum heap size seen by getHeapStats()
+};
+#endif
+
 class TrappmannRobotics {
 private:
 	TrappmannRobotics() {}
 
 public:
 	static const char *getUploadTimestamp();
+	static const __FlashStringHelper *getBuildTimestamp();
 #if defined(__avr__)
 	static uint32_t getFreeMemory();
 	static uint32_t getProgramCounter();
+	static HeapStats getHeapStats();
+	static void printHeapMap(Print &out);
 #endif
 };
 
@@ -0,0 +1,94 @@
+// NAME: BinaryFrame.cpp
+//
+// DESC: Compact binary telemetry frames with typed fields, CRC-16 and COBS framing
+//       as an alternative to printing values as text.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "BinaryFrame.h"
+#include "Crc16.h"
+#include <string.h>
+
+void FrameEncoder::begin(const uint8_t frameType) {
+  buffer[0] = frameType;
+  len = 1;
+  overflow = false;
+}
+
+bool FrameEncoder::addField(const uint8_t id, const FrameFieldType type, const void *value, const uint8_t size) {
+  // keep 2 bytes for the CRC
+  if ((id > FRAME_MAX_FIELD_ID) || (len + 1 + size + 2 > capacity)) {
+	overflow = true;
+	return false;
+  }
+  buffer[len++] = (type << 5) | id;
+  memcpy(&buffer[len], value, size);
+  len += size;
+  return true;
+}
+
+bool FrameEncoder::addRaw(const void *data, const uint8_t size) {
+  if (len + size + 2 > capacity) {
+	overflow = true;
+	return false;
+  }
+  memcpy(&buffer[len], data, size);
+  len += size;
+  return true;
+}
+
+/*
+ * Append the CRC and send the frame COBS encoded.
+ */
+size_t FrameEncoder::send(Print &out) {
+  const uint16_t crc = crc16(buffer, len);
+  buffer[len] = crc & 0xff;
+  buffer[len+1] = crc >> 8;
+  return cobsEncode(out, buffer, len + 2);
+}
+
+/*
+ * Consistent Overhead Byte Stuffing: every run of up to 254 non-zero bytes is
+ * preceded by a code byte holding its length plus one. The code replaces the
+ * zero byte following the run, so the encoded data contains no zero bytes.
+ * A code of 0xff marks a run of 254 bytes without a following zero.
+ */
+size_t cobsEncode(Print &out, const uint8_t *data, const size_t len) {
+  size_t n = 0;
+  size_t pos = 0;
+  for (;;) {
+	const size_t start = pos;
+	while ((pos < len) && (0 != data[pos]) && (pos - start < 254)) pos++;
+
+	const uint8_t run = pos - start;
+	n += out.write((uint8_t)(run + 1));
+	n += out.write(&data[start], run);
+	if (pos >= len) break;
+	if (254 != run) pos++; // skip the zero byte replaced by the code
+  }
+  n += out.write((uint8_t)0);
+  return n;
+}
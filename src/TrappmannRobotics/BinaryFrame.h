@@ -0,0 +1,109 @@
+// NAME: BinaryFrame.h
+//
+// DESC: Compact binary telemetry frames with typed fields, CRC-16 and COBS framing
+//       as an alternative to printing values as text.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef BINARYFRAME_H
+#define BINARYFRAME_H
+
+#include <stdint.h>
+#include <Print.h>
+
+/*
+ * Type of a field, stored in the upper 3 bits of the field header byte.
+ * The lower 5 bits hold the field id 0..31. Values follow little endian.
+ */
+enum FrameFieldType {
+  FIELD_U8 = 0,
+  FIELD_I8 = 1,
+  FIELD_U16 = 2,
+  FIELD_I16 = 3,
+  FIELD_U32 = 4,
+  FIELD_I32 = 5,
+  FIELD_FLOAT = 6
+};
+
+#define FRAME_MAX_FIELD_ID	31
+
+/*
+ * Layout of a frame before encoding:
+ *   frame type (1 byte), fields (header byte + value), CRC-16 (2 bytes)
+ * The frame is sent COBS encoded, so it contains no zero bytes and is
+ * terminated by a single zero byte. Use extras/decode_frames.py on the host.
+ */
+class FrameEncoder {
+private:
+  uint8_t *buffer;
+  uint8_t capacity;
+  uint8_t len;
+  bool overflow;
+
+protected:
+  FrameEncoder(uint8_t *buffer, const uint8_t capacity) : buffer(buffer), capacity(capacity), len(0), overflow(false) {}
+
+public:
+  void begin(const uint8_t frameType);
+
+  bool add(const uint8_t id, const uint8_t value)  { return addField(id, FIELD_U8, &value, sizeof(value)); }
+  bool add(const uint8_t id, const int8_t value)   { return addField(id, FIELD_I8, &value, sizeof(value)); }
+  bool add(const uint8_t id, const uint16_t value) { return addField(id, FIELD_U16, &value, sizeof(value)); }
+  bool add(const uint8_t id, const int16_t value)  { return addField(id, FIELD_I16, &value, sizeof(value)); }
+  bool add(const uint8_t id, const uint32_t value) { return addField(id, FIELD_U32, &value, sizeof(value)); }
+  bool add(const uint8_t id, const int32_t value)  { return addField(id, FIELD_I32, &value, sizeof(value)); }
+  bool add(const uint8_t id, const float value)    { return addField(id, FIELD_FLOAT, &value, sizeof(value)); }
+
+  // Append untyped data for frame types with their own layout.
+  bool addRaw(const void *data, const uint8_t size);
+
+  size_t send(Print &out);
+
+  uint8_t length() const { return len; }
+  bool hasOverflow() const { return overflow; }
+
+private:
+  bool addField(const uint8_t id, const FrameFieldType type, const void *value, const uint8_t size);
+};
+
+/*
+ * Frame with room for N bytes of fields plus frame type and CRC.
+ * N must not exceed 250, so the frame fits into a single COBS block.
+ */
+template<uint8_t N> class BinaryFrame : public FrameEncoder {
+  static_assert((N > 0) && (N <= 250), "BinaryFrame size must be 1 to 250 bytes to fit into a COBS block");
+
+private:
+  uint8_t storage[N + 3];
+
+public:
+  BinaryFrame() : FrameEncoder(storage, N + 3) {}
+};
+
+// Write len bytes COBS encoded followed by the zero delimiter.
+size_t cobsEncode(Print &out, const uint8_t *data, const size_t len);
+
+#endif /* BINARYFRAME_H */
@@ -0,0 +1,84 @@
+// NAME: BuildInfo.cpp
+//
+// DESC: Build metadata record in flash: timestamp, Sketch name hash, library and
+//       compiler version and image size, at the start of the PROGMEM data.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "BuildInfo.h"
+
+#if defined(__avr__)
+#include <stddef.h>
+
+/*
+ * A weak reference, so the address of the record is 0 without
+ * TRAPPMANNROBOTICS_BUILD_INFO in the Sketch. A weak default record would be
+ * kept in the vectors section besides the one of the Sketch.
+ */
+extern const BuildInfo buildInfo __attribute__ ((weak));
+
+bool BuildInfo::isValid() {
+  return (0L != &buildInfo) && (BUILDINFO_MAGIC == pgm_read_dword(&buildInfo.magic));
+}
+
+const __FlashStringHelper *BuildInfo::getTimestamp() {
+  if (!isValid()) return F(__DATE__ " " __TIME__);
+  return (const __FlashStringHelper *)buildInfo.timestamp;
+}
+
+const __FlashStringHelper *BuildInfo::getLibraryVersion() {
+  if (!isValid()) return F(TRAPPMANNROBOTICS_VERSION);
+  return (const __FlashStringHelper *)buildInfo.libraryVersion;
+}
+
+uint32_t BuildInfo::getSketchHash() {
+  if (!isValid()) return 0;
+  return pgm_read_dword(&buildInfo.sketchHash);
+}
+
+uint32_t BuildInfo::getCompilerVersion() {
+  if (!isValid()) return ((uint32_t)__GNUC__ << 16) | (__GNUC_MINOR__ << 8) | __GNUC_PATCHLEVEL__;
+  return ((uint32_t)pgm_read_byte(&buildInfo.compilerVersion[0]) << 16) |
+		 ((uint16_t)pgm_read_byte(&buildInfo.compilerVersion[1]) << 8) |
+		 pgm_read_byte(&buildInfo.compilerVersion[2]);
+}
+
+uint16_t BuildInfo::getImageSize() {
+  if (!isValid()) return 0;
+  return pgm_read_word(&buildInfo.imageEnd);
+}
+
+void BuildInfo::print(Print &out) {
+  out << F("Build:    ") << getTimestamp() << '\n';
+  out << F("Library:  ") << getLibraryVersion() << '\n';
+  out << F("Sketch:   0x") << hex32(getSketchHash()) << '\n';
+  const uint32_t compiler = getCompilerVersion();
+  out << F("Compiler: avr-gcc ") << (uint8_t)(compiler >> 16) << '.'
+	  << (uint8_t)(compiler >> 8) << '.' << (uint8_t)compiler << '\n';
+  out << F("Image:    ") << getImageSize() << F(" bytes\n");
+}
+
+#endif /* __avr__ */
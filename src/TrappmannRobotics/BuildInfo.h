@@ -0,0 +1,105 @@
+// NAME: BuildInfo.h
+//
+// DESC: Build metadata record in flash: timestamp, Sketch name hash, library and
+//       compiler version and image size, at the start of the PROGMEM data.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef BUILDINFO_H
+#define BUILDINFO_H
+
+#if defined(__avr__)
+#include <stdint.h>
+#include <WString.h>
+#include <avr/pgmspace.h>
+#include <TrappmannRobotics.h>
+
+#define BUILDINFO_MAGIC		0x49425254UL	// "TRBI"
+#define BUILDINFO_VERSION	1
+
+// The record is put into the section of the interrupt vectors. The linker script
+// of avr-gcc places it first into flash, with KEEP, and the vectors of the crt
+// object come first, so the record starts at the end of the vector table. A
+// bootloader finds it there at BUILDINFO_ADDRESS, ie. 0x68 on an ATmega328P.
+#define BUILDINFO_SECTION	".vectors"
+#define BUILDINFO_ADDRESS	_VECTORS_SIZE
+
+/*
+ * Layout of the record in flash. Host tools and bootloaders check the magic at
+ * BUILDINFO_ADDRESS and must check the size to skip fields of newer versions. The image size is the
+ * end of the initialized data in flash, it is 0 on devices with more than 64K.
+ */
+struct BuildInfo {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t size;
+  char timestamp[21];			// __DATE__ " " __TIME__
+  char libraryVersion[9];		// TRAPPMANNROBOTICS_VERSION
+  uint32_t sketchHash;			// FNV-1a of the file name of the Sketch or 0
+  uint8_t compilerVersion[3];	// major, minor, patch level of avr-gcc
+  const char *imageEnd;
+
+  static bool isValid();
+  static const __FlashStringHelper *getTimestamp();
+  static const __FlashStringHelper *getLibraryVersion();
+  static uint32_t getSketchHash();
+  static uint32_t getCompilerVersion();	// 0x00MMmmpp
+  static uint16_t getImageSize();
+  static void print(Print &out);
+} __attribute__ ((packed));
+
+// Defined by TRAPPMANNROBOTICS_BUILD_INFO in the Sketch.
+extern const BuildInfo buildInfo;
+
+// FNV-1a hash of a string at compile time.
+constexpr uint32_t constHash(const char *str, const uint32_t hash = 2166136261UL) {
+  return ('\0' == *str) ? hash : constHash(str + 1, (hash ^ (uint8_t)*str) * 16777619UL);
+}
+
+#if FLASHEND > 0xffff
+#define BUILDINFO_IMAGE_END	0L
+#else
+extern char __data_load_end;
+#define BUILDINFO_IMAGE_END	&__data_load_end
+#endif
+
+#define BUILDINFO_RECORD(hash) { \
+  BUILDINFO_MAGIC, BUILDINFO_VERSION, sizeof(BuildInfo), __DATE__ " " __TIME__, TRAPPMANNROBOTICS_VERSION, \
+  (hash), { __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__ }, BUILDINFO_IMAGE_END }
+
+/*
+ * Put TRAPPMANNROBOTICS_BUILD_INFO once into the Sketch to store a record with
+ * the time the Sketch was compiled and the hash of its file name. Without it,
+ * there is no record and the accessors return the values of the library build,
+ * ie. the time the library was compiled and a Sketch hash of 0.
+ */
+#define TRAPPMANNROBOTICS_BUILD_INFO \
+  extern const BuildInfo buildInfo __attribute__ ((section(BUILDINFO_SECTION), used)) = \
+	BUILDINFO_RECORD(constHash(constBaseName(__FILE__)))
+
+#endif /* __avr__ */
+
+#endif /* BUILDINFO_H */
@@ -67,7 +67,28 @@ bool callWithWatchdog(void (*func)(void *, void*), void *args, void *results, Wa
 }
 
 #ifdef DEFINE_TIMEOUT_ISR
-ISR(WDT_vect) {
+/*
+ * In interrupt mode without reset, ie. while System::haltLowPower() sleeps, the
+ * watchdog only wakes up the CPU and the handler returns at once. Otherwise a
+ * call of callWithWatchdog() timed out and the handler jumps to the timeout
+ * handler below, which finds the stack as it was at the entry of the vector.
+ */
+ISR(WDT_vect, ISR_NAKED) {
+  asm volatile (
+    ".equ WDTCSR, 0x0060            ; register address for WDTCSR\n\t"
+    ".equ WDE, 3                    ; WDE bit of WDTCSR\n\t"
+    "     push  r24                 ; save r24, SREG is not changed below\n\t"
+    "     lds   r24, WDTCSR         ; load WDTCSR\n\t"
+    "     sbrc  r24, WDE            ; skip next instruction if WDE bit is clear\n\t"
+    "     rjmp  1f                  ; timeout of callWithWatchdog()\n\t"
+    "     pop   r24                 ; restore r24\n\t"
+    "     reti                      ; only woken up from sleep\n\t"
+    "1:   pop   r24                 ; restore r24\n\t"
+    "     jmp   __vector_timeout    ; handle the timeout\n\t"
+  );
+}
+
+ISR(__vector_timeout) {
   // r1, r0 and Status Register (0x3f) are pushed on the stack  (3 bytes)
   // r1 is zero
   // register pair (r24/r25) is pushed to the stack and loaded with alarmSP  (2 bytes)
@@ -0,0 +1,81 @@
+// NAME: CsvPrint.cpp
+//
+// DESC: Streaming CSV writer on top of the stream operator. Rows are written field
+//       by field without buffering.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "CsvPrint.h"
+#include <avr/pgmspace.h>
+
+void CsvPrint::nextField() {
+  if (first) first = false;
+  else out.write(separator);
+}
+
+/*
+ * Text is quoted, if it contains the separator, a quote or a line break.
+ * Quotes inside of the text are doubled.
+ */
+void CsvPrint::writeText(const char *str, const bool progmem) {
+  bool quote = false;
+  for (const char *p = str; ; p++) {
+	const char c = progmem ? pgm_read_byte(p) : *p;
+	if ('\0' == c) break;
+	if ((separator == c) || ('"' == c) || ('\n' == c) || ('\r' == c)) {
+	  quote = true;
+	  break;
+	}
+  }
+
+  if (quote) out.write('"');
+  for (;;) {
+	const char c = progmem ? pgm_read_byte(str) : *str;
+	if ('\0' == c) break;
+	str++;
+	if ('"' == c) out.write('"');
+	out.write(c);
+  }
+  if (quote) out.write('"');
+}
+
+CsvPrint& CsvPrint::field(const char *value) {
+  nextField();
+  writeText(value, false);
+  return *this;
+}
+
+CsvPrint& CsvPrint::field(const __FlashStringHelper *value) {
+  nextField();
+  writeText((const char *)value, true);
+  return *this;
+}
+
+CsvPrint& CsvPrint::end() {
+  out.write('\n');
+  first = true;
+  return *this;
+}
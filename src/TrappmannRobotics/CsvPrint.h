@@ -0,0 +1,79 @@
+// NAME: CsvPrint.h
+//
+// DESC: Streaming CSV writer on top of the stream operator. Rows are written field
+//       by field without buffering.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef CSVPRINT_H
+#define CSVPRINT_H
+
+#include <stdint.h>
+#include <Print.h>
+#include <TrappmannRobotics_StringHelper.h>
+
+/*
+ * Writes rows of comma separated values directly to a Print object, ie.
+ *   csv << millis() << x << y << z << CsvPrint::endRow;
+ * Text fields containing the separator, quotes or line breaks are quoted.
+ */
+class CsvPrint {
+public:
+  // Marker to terminate the current row with the stream operator.
+  enum EndRow { endRow };
+
+private:
+  Print &out;
+  char separator;
+  bool first;
+
+public:
+  CsvPrint(Print &out, const char separator = ',') : out(out), separator(separator), first(true) {}
+
+  template<class T> CsvPrint& field(const T value) {
+	nextField();
+	out << value;
+	return *this;
+  }
+  CsvPrint& field(const char *value);
+  CsvPrint& field(char *value) { return field((const char *)value); }
+  CsvPrint& field(const __FlashStringHelper *value);
+  template<uint8_t N> CsvPrint& field(const StaticString<N>& value) { return field(value.c_str()); }
+#ifndef TRAPPMANNROBOTICS_NO_STRING
+  CsvPrint& field(const String& value) { return field(value.c_str()); }
+#endif
+
+  CsvPrint& end();
+
+private:
+  void nextField();
+  void writeText(const char *str, const bool progmem);
+};
+
+template<class T> inline CsvPrint& operator <<(CsvPrint &csv, const T& value) { return csv.field(value); }
+inline CsvPrint& operator <<(CsvPrint &csv, const CsvPrint::EndRow) { return csv.end(); }
+
+#endif /* CSVPRINT_H */
@@ -0,0 +1,98 @@
+// NAME: HexDump.cpp
+//
+// DESC: Hexdump of RAM, EEPROM and PROGMEM regions to a Print object.
+//       Every line is formatted on the stack and emitted with a single write.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "HexDump.h"
+
+#if defined(__avr__)
+#include <string.h>
+#include <avr/eeprom.h>
+#include <avr/pgmspace.h>
+#include <TrappmannRobotics_StringHelper.h>
+
+/*
+ * Read a chunk of up to HEXDUMP_BYTES_PER_LINE bytes from the memory source.
+ */
+static void readChunk(uint8_t *data, const HexDumpSource source, const uint32_t addr, const uint8_t len) {
+  switch (source) {
+	case HEXDUMP_EEPROM:
+	  eeprom_read_block(data, (const void *)(uint16_t)addr, len);
+	  break;
+	case HEXDUMP_PROGMEM:
+#if defined(RAMPZ)
+	  if (addr + len > 0x10000UL) {
+		for (uint8_t i=0; i<len; i++) data[i] = pgm_read_byte_far(addr + i);
+		break;
+	  }
+#endif
+	  memcpy_P(data, (const void *)(uint16_t)addr, len);
+	  break;
+	default:
+	  memcpy(data, (const void *)(uint16_t)addr, len);
+	  break;
+  }
+}
+
+void hexDump(Print &out, const HexDumpSource source, const uint32_t addr, const uint16_t len) {
+  const uint8_t addrWidth = (addr + len > 0x10000UL) ? 6 : 4;
+
+  // address, separator, hex values, ASCII column and line feed
+  char line[6 + 2 + 3*HEXDUMP_BYTES_PER_LINE + 3 + HEXDUMP_BYTES_PER_LINE + 2];
+  uint8_t data[HEXDUMP_BYTES_PER_LINE];
+
+  // 32 bit offset, a 16 bit one would wrap around for len > 0xfff0
+  for (uint32_t offset = 0; offset < len; offset += HEXDUMP_BYTES_PER_LINE) {
+	const uint8_t count = (len - offset < HEXDUMP_BYTES_PER_LINE) ? (len - offset) : HEXDUMP_BYTES_PER_LINE;
+	readChunk(data, source, addr + offset, count);
+
+	char *p = formatHex(line, addr + offset, addrWidth);
+	*p++ = ':';
+	for (uint8_t i=0; i<HEXDUMP_BYTES_PER_LINE; i++) {
+	  *p++ = ' ';
+	  if (i < count) {
+		p = formatHex(p, data[i], 2);
+	  } else {
+		*p++ = ' ';
+		*p++ = ' ';
+	  }
+	}
+	*p++ = ' ';
+	*p++ = ' ';
+	*p++ = '|';
+	for (uint8_t i=0; i<count; i++) {
+	  *p++ = ((data[i] >= 0x20) && (data[i] < 0x7f)) ? data[i] : '.';
+	}
+	*p++ = '|';
+	*p++ = '\n';
+
+	out.write((const uint8_t *)line, p - line);
+  }
+}
+
+#endif /* __avr__ */
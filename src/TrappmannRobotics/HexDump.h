@@ -0,0 +1,56 @@
+// NAME: HexDump.h
+//
+// DESC: Hexdump of RAM, EEPROM and PROGMEM regions to a Print object.
+//       Every line is formatted on the stack and emitted with a single write.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEXDUMP_H
+#define HEXDUMP_H
+
+#if defined(__avr__)
+#include <stdint.h>
+#include <Print.h>
+
+enum HexDumpSource {
+  HEXDUMP_RAM = 0,
+  HEXDUMP_EEPROM = 1,
+  HEXDUMP_PROGMEM = 2
+};
+
+// Number of bytes shown on each line of the dump.
+#define HEXDUMP_BYTES_PER_LINE	16
+
+/*
+ * Dump len bytes starting at addr of the given memory source to out.
+ * Each line shows the address, the hex values and the ASCII representation:
+ * 0000: 2a 00 42 00 ff ff ff ff ff ff ff ff ff ff ff ff  |*.B.............|
+ */
+void hexDump(Print &out, const HexDumpSource source, const uint32_t addr, const uint16_t len);
+
+#endif /* __avr__ */
+
+#endif /* HEXDUMP_H */
@@ -0,0 +1,185 @@
+// NAME: JsonPrint.cpp
+//
+// DESC: Streaming JSON writer on top of the stream operator. Objects and arrays
+//       are written incrementally without building a document in memory.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "JsonPrint.h"
+#include <math.h>
+#include <avr/pgmspace.h>
+
+/*
+ * Write a string in double quotes and escape quotes, backslashes and control
+ * characters. The string may reside in RAM or in flash memory.
+ */
+static void writeString(Print &out, const char *str, const bool progmem) {
+  out.write('"');
+  for (;;) {
+	const char c = progmem ? pgm_read_byte(str) : *str;
+	if ('\0' == c) break;
+	str++;
+
+	if (('"' == c) || ('\\' == c)) {
+	  out.write('\\');
+	  out.write(c);
+	}
+	else if ('\n' == c) out.write("\\n");
+	else if ('\r' == c) out.write("\\r");
+	else if ('\t' == c) out.write("\\t");
+	else if ((uint8_t)c < 0x20) out << F("\\u00") << hex8(c);
+	else out.write(c);
+  }
+  out.write('"');
+}
+
+/*
+ * Write a comma in front of every element but the first one of the current level.
+ */
+void JsonPrint::separator() {
+  if (afterKey) {
+	afterKey = false;
+	return;
+  }
+  if (0 == depth) return;
+
+  const uint16_t bit = 1U << (depth - 1);
+  if (first & bit) first &= ~bit;
+  else out.write(',');
+}
+
+/*
+ * A level beyond JSONPRINT_MAX_DEPTH is refused and written as null. Everything
+ * up to its matching close() is skipped, so the output stays valid JSON.
+ */
+JsonPrint& JsonPrint::open(const char c, const bool isArray) {
+  if (skipped) {
+	skipped++;
+	return *this;
+  }
+  separator();
+  if (depth >= JSONPRINT_MAX_DEPTH) {
+	out.print(F("null"));
+	error = true;
+	skipped = 1;
+	return *this;
+  }
+  out.write(c);
+  const uint16_t bit = 1U << depth;
+  if (isArray) arrays |= bit;
+  else arrays &= ~bit;
+  first |= bit;
+  depth++;
+  return *this;
+}
+
+JsonPrint& JsonPrint::close() {
+  if (skipped) {
+	skipped--;
+	return *this;
+  }
+  if (0 == depth) {
+	error = true;
+	return *this;
+  }
+  depth--;
+  out.write((arrays & (1U << depth)) ? ']' : '}');
+  if (0 == depth) out.write('\n');
+  return *this;
+}
+
+JsonPrint& JsonPrint::beginObject() {
+  return open('{', false);
+}
+
+JsonPrint& JsonPrint::beginArray() {
+  return open('[', true);
+}
+
+JsonPrint& JsonPrint::key(const __FlashStringHelper *key) {
+  if (skipped) return *this;
+  separator();
+  writeString(out, (const char *)key, true);
+  out.write(':');
+  afterKey = true;
+  return *this;
+}
+
+JsonPrint& JsonPrint::key(const char *key) {
+  if (skipped) return *this;
+  separator();
+  writeString(out, key, false);
+  out.write(':');
+  afterKey = true;
+  return *this;
+}
+
+JsonPrint& JsonPrint::value(const bool value) {
+  if (skipped) return *this;
+  separator();
+  out.print(value ? F("true") : F("false"));
+  return *this;
+}
+
+JsonPrint& JsonPrint::value(const char value) {
+  const char str[2] = { value, '\0' };
+  if (skipped) return *this;
+  separator();
+  writeString(out, str, false);
+  return *this;
+}
+
+JsonPrint& JsonPrint::value(const char *value) {
+  if (skipped) return *this;
+  separator();
+  writeString(out, value, false);
+  return *this;
+}
+
+JsonPrint& JsonPrint::value(const __FlashStringHelper *value) {
+  if (skipped) return *this;
+  separator();
+  writeString(out, (const char *)value, true);
+  return *this;
+}
+
+/*
+ * JSON knows no representation for NaN and infinity, so these are written as null.
+ */
+JsonPrint& JsonPrint::value(const double value, const uint8_t digits) {
+  if (skipped) return *this;
+  separator();
+  if (isnan(value) || isinf(value)) out.print(F("null"));
+  else out.print(value, digits);
+  return *this;
+}
+
+JsonPrint& JsonPrint::null() {
+  if (skipped) return *this;
+  separator();
+  out.print(F("null"));
+  return *this;
+}
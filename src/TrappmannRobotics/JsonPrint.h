@@ -0,0 +1,104 @@
+// NAME: JsonPrint.h
+//
+// DESC: Streaming JSON writer on top of the stream operator. Objects and arrays
+//       are written incrementally without building a document in memory.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef JSONPRINT_H
+#define JSONPRINT_H
+
+#include <stdint.h>
+#include <Print.h>
+#include <TrappmannRobotics_StringHelper.h>
+
+// Maximum nesting depth of objects and arrays.
+#define JSONPRINT_MAX_DEPTH	16
+
+/*
+ * Writes JSON directly to a Print object, ie.
+ *   json.beginObject().member(F("time"), millis()).key(F("acc")).beginArray()
+ *       .value(x).value(y).value(z).endArray().endObject();
+ * The nesting is kept in two bit masks, so no heap and no document tree is
+ * needed. After the outermost object or array a newline is printed, which
+ * separates the frames of a telemetry stream.
+ */
+class JsonPrint {
+private:
+  Print &out;
+  uint16_t arrays;	// bit per level: level is an array
+  uint16_t first;	// bit per level: no element written yet
+  uint8_t depth;
+  uint8_t skipped;	// levels refused beyond JSONPRINT_MAX_DEPTH
+  bool afterKey;
+  bool error;
+
+public:
+  JsonPrint(Print &out) : out(out), arrays(0), first(0), depth(0), skipped(0), afterKey(false), error(false) {}
+
+  JsonPrint& beginObject();
+  JsonPrint& beginObject(const __FlashStringHelper *key) { return this->key(key).beginObject(); }
+  JsonPrint& endObject() { return close(); }
+
+  JsonPrint& beginArray();
+  JsonPrint& beginArray(const __FlashStringHelper *key) { return this->key(key).beginArray(); }
+  JsonPrint& endArray() { return close(); }
+
+  JsonPrint& key(const __FlashStringHelper *key);
+  JsonPrint& key(const char *key);
+
+  template<class T> JsonPrint& value(const T value) {
+	if (skipped) return *this;
+	separator();
+	out << value;
+	return *this;
+  }
+  JsonPrint& value(const bool value);
+  JsonPrint& value(const char value);
+  JsonPrint& value(const char *value);
+  JsonPrint& value(char *value) { return this->value((const char *)value); }
+  template<uint8_t N> JsonPrint& value(const StaticString<N>& value) { return this->value(value.c_str()); }
+#ifndef TRAPPMANNROBOTICS_NO_STRING
+  JsonPrint& value(const String& value) { return this->value(value.c_str()); }
+#endif
+  JsonPrint& value(const __FlashStringHelper *value);
+  JsonPrint& value(const double value, const uint8_t digits = 2);
+  JsonPrint& value(const float value, const uint8_t digits = 2) { return this->value((double)value, digits); }
+  JsonPrint& null();
+
+  template<class T> JsonPrint& member(const __FlashStringHelper *key, const T& value) { return this->key(key).value(value); }
+
+  uint8_t getDepth() const { return depth; }
+  bool hasError() const { return error; }
+  void clearError() { error = false; }
+
+private:
+  JsonPrint& open(const char c, const bool isArray);
+  JsonPrint& close();
+  void separator();
+};
+
+#endif /* JSONPRINT_H */
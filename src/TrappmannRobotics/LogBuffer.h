@@ -0,0 +1,115 @@
+// NAME: LogBuffer.h
+//
+// DESC: Interrupt safe ring buffer log sink. Writes from loop() and from ISRs
+//       only copy into RAM, drain() pushes the bytes to Serial later.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef LOGBUFFER_H
+#define LOGBUFFER_H
+
+#if defined(__avr__)
+#include <stdint.h>
+#include <Print.h>
+#include <util/atomic.h>
+
+/*
+ * Ring buffer of N bytes, N must be a power of two up to 128. Head and tail are
+ * free running 8-bit counters, so they are read and written atomically and the
+ * number of used bytes is always head - tail.
+ * Any number of producers may write, including ISRs: a write disables interrupts
+ * only while copying into the buffer. There must be a single consumer calling
+ * drain(), ie. loop() or the idle path. If the buffer is full, the rest of the
+ * write is dropped and counted.
+ */
+template<uint8_t N> class LogBuffer : public Print {
+  static_assert((N > 0) && (N <= 128) && (0 == (N & (N - 1))), "LogBuffer size must be a power of two up to 128");
+
+private:
+  uint8_t buffer[N];
+  volatile uint8_t head;	// written by the producers
+  volatile uint8_t tail;	// written by the consumer
+  volatile uint8_t peak;
+  volatile uint16_t droppedBytes;
+  volatile uint16_t overflowCount;
+
+public:
+  LogBuffer() : head(0), tail(0), peak(0), droppedBytes(0), overflowCount(0) {}
+
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t *data, size_t size) {
+	size_t n = 0;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	  const uint8_t used = head - tail;
+	  n = (size > (size_t)(N - used)) ? (N - used) : size;
+	  for (uint8_t i = 0; i < n; i++) {
+		buffer[(uint8_t)(head + i) & (N - 1)] = data[i];
+	  }
+	  head += n;
+	  if (used + n > peak) peak = used + n;
+	  if (n < size) {
+		droppedBytes += size - n;
+		overflowCount++;
+	  }
+	}
+	return n;
+  }
+  using Print::write;
+
+  /*
+   * Write up to max buffered bytes to out and return their number.
+   * Pass Serial.availableForWrite() as max to never block on a full TX buffer.
+   */
+  size_t drain(Print &out, const size_t max = N) {
+	size_t n = 0;
+	while (n < max) {
+	  const uint8_t h = head;
+	  const uint8_t t = tail;
+	  if (h == t) break;
+
+	  // write the contiguous part up to the end of the buffer
+	  const uint8_t pos = t & (N - 1);
+	  uint8_t len = h - t;
+	  if (len > N - pos) len = N - pos;
+	  if (len > max - n) len = max - n;
+	  out.write(&buffer[pos], len);
+	  tail = t + len;
+	  n += len;
+	}
+	return n;
+  }
+
+  uint8_t available() const { return head - tail; }
+  uint8_t capacity() const { return N; }
+  uint8_t getPeak() const { return peak; }
+  uint16_t getDroppedBytes() const { uint16_t n; ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { n = droppedBytes; } return n; }
+  uint16_t getOverflowCount() const { uint16_t n; ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { n = overflowCount; } return n; }
+  void clearStats() { ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { peak = head - tail; droppedBytes = 0; overflowCount = 0; } }
+};
+
+#endif /* __avr__ */
+
+#endif /* LOGBUFFER_H */
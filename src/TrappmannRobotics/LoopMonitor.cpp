@@ -0,0 +1,99 @@
+// NAME: LoopMonitor.cpp
+//
+// DESC: Latency and jitter of loop(): the duration of each pass is kept in a log2
+//       histogram together with mean, maximum and the number of deadline overruns.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "LoopMonitor.h"
+#include <Arduino.h>
+#include <TrappmannRobotics_StringHelper.h>
+
+/*
+ * The bin is the bit length of the duration, which is found byte by byte
+ * first, as 32-bit shifts are slow on AVR. Before the sum overflows, sum and
+ * count are halved, which keeps the mean.
+ */
+void LoopMonitor::tick() {
+  const uint32_t now = micros();
+  if (!started) {
+	started = true;
+	last = now;
+	return;
+  }
+  const uint32_t duration = now - last;
+  last = now;
+
+  uint8_t bin = 0;
+  uint32_t value = duration;
+  while (value > 0xff) {
+	value >>= 8;
+	bin += 8;
+  }
+  while (value) {
+	value >>= 1;
+	bin++;
+  }
+  if (bin >= LOOPMONITOR_BINS) bin = LOOPMONITOR_BINS - 1;
+  if (histogram[bin] < 0xffff) histogram[bin]++;
+
+  if (sum + duration < sum) {
+	sum >>= 1;
+	count >>= 1;
+  }
+  sum += duration;
+  count++;
+  if (duration > max) max = duration;
+  if (deadline && (duration > deadline) && (overruns < 0xffff)) overruns++;
+}
+
+/*
+ * The next tick() starts a new measurement.
+ */
+void LoopMonitor::reset() {
+  started = false;
+  count = sum = max = 0;
+  overruns = 0;
+  for (uint8_t i = 0; i < LOOPMONITOR_BINS; i++) histogram[i] = 0;
+}
+
+/*
+ * Print the statistics and the non-empty bins of the histogram, ie.
+ * loops=12034 mean=412 max=2876 us, overruns=3
+ *   <512us: 11890 <1024us: 140 <4096us: 4
+ */
+void LoopMonitor::dump(Print &out) const {
+  out << F("loops=") << count << F(" mean=") << getMean() << F(" max=") << max << F(" us");
+  if (deadline) out << F(", overruns=") << overruns;
+  out << F("\n ");
+  for (uint8_t i = 0; i < LOOPMONITOR_BINS; i++) {
+	if (!histogram[i]) continue;
+	if (i < LOOPMONITOR_BINS - 1) out << F(" <") << (1UL << i);
+	else out << F(" >=") << (1UL << (i - 1));
+	out << F("us: ") << histogram[i];
+  }
+  out << '\n';
+}
@@ -0,0 +1,74 @@
+// NAME: LoopMonitor.h
+//
+// DESC: Latency and jitter of loop(): the duration of each pass is kept in a log2
+//       histogram together with mean, maximum and the number of deadline overruns.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef LOOPMONITOR_H
+#define LOOPMONITOR_H
+
+#include <stdint.h>
+#include <Print.h>
+
+// Number of bins of the histogram: <1us, <2us, <4us, ... the last bin counts all longer passes.
+#define LOOPMONITOR_BINS	20
+
+/*
+ * Call tick() once at the top of loop(). Each call records the time since
+ * the previous call, measured by micros().
+ *   LoopMonitor loopMonitor(1000); // deadline of 1ms
+ *   void loop() {
+ *     loopMonitor.tick();
+ *     ...
+ *   }
+ */
+class LoopMonitor {
+private:
+  uint32_t deadline;
+  uint32_t last;
+  uint32_t count;
+  uint32_t sum;
+  uint32_t max;
+  uint16_t overruns;
+  uint16_t histogram[LOOPMONITOR_BINS];
+  bool started;
+
+public:
+  LoopMonitor(const uint32_t deadline = 0) : deadline(deadline) { reset(); }
+
+  void tick();
+  void reset();
+
+  uint32_t getCount() const { return count; }
+  uint32_t getMean() const { return count ? sum / count : 0; }
+  uint32_t getMax() const { return max; }
+  uint16_t getOverruns() const { return overruns; }
+  uint16_t getBin(const uint8_t bin) const { return histogram[bin]; }
+  void dump(Print &out) const;
+};
+
+#endif /* LOOPMONITOR_H */
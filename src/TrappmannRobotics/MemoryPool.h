@@ -0,0 +1,189 @@
+// NAME: MemoryPool.h
+//
+// DESC: Fixed block pool and arena allocators with O(1) allocate and free as
+//       replacement for malloc() and free() of small objects in steady state.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef MEMORYPOOL_H
+#define MEMORYPOOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new.h>
+#include <Print.h>
+#if defined(__avr__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#else
+#include <Arduino.h>
+#endif
+
+/*
+ * Usage statistics of a pool (in blocks) or an arena (in bytes).
+ */
+struct PoolStats {
+  uint16_t inUse;
+  uint16_t peak;
+  uint16_t failures;	// number of failed allocations
+};
+
+Print& operator <<(Print &out, const PoolStats &stats);
+
+/*
+ * Disables interrupts for its lifetime, if the pool is used from ISRs.
+ */
+template<bool ISRSafe> struct PoolLock {
+  PoolLock() {}
+};
+
+template<> struct PoolLock<true> {
+#if defined(__avr__)
+  const uint8_t sreg;
+  PoolLock() : sreg(SREG) { cli(); }
+  ~PoolLock() { SREG = sreg; }
+#else
+  PoolLock() { noInterrupts(); }
+  ~PoolLock() { interrupts(); }
+#endif
+};
+
+/*
+ * Pool of N blocks for objects of type T. The free blocks are kept in a single
+ * linked list inside the blocks themselves. Blocks which were never used are
+ * taken in order, so the constructor does not need to build the list.
+ *   FixedPool<Message, 8> pool;
+ *   Message *msg = pool.create(id, value);
+ *   pool.destroy(msg);
+ */
+template<class T, uint16_t N, bool ISRSafe = false> class FixedPool {
+private:
+  union Block {
+	Block *next;
+	uint8_t data[sizeof(T)];
+  } __attribute__ ((aligned(__alignof__(T))));
+
+  Block blocks[N];
+  Block *freeList;
+  uint16_t fresh;		// number of blocks taken from the array
+  PoolStats stats;
+
+public:
+  FixedPool() : freeList(0L), fresh(0) { stats.inUse = stats.peak = stats.failures = 0; }
+
+  // Return an uninitialized block or 0L, if all blocks are in use.
+  void *allocate() {
+	PoolLock<ISRSafe> lock;
+	Block *block;
+	if (freeList) {
+	  block = freeList;
+	  freeList = block->next;
+	}
+	else if (fresh < N) {
+	  block = &blocks[fresh++];
+	}
+	else {
+	  stats.failures++;
+	  return 0L;
+	}
+	if (++stats.inUse > stats.peak) stats.peak = stats.inUse;
+	return block;
+  }
+
+  void free(void *ptr) {
+	if (!ptr) return;
+	PoolLock<ISRSafe> lock;
+	Block *block = (Block *)ptr;
+	block->next = freeList;
+	freeList = block;
+	stats.inUse--;
+  }
+
+  template<typename... Args> T *create(Args... args) {
+	void *ptr = allocate();
+	return ptr ? new (ptr) T(args...) : 0L;
+  }
+
+  void destroy(T *obj) {
+	if (!obj) return;
+	obj->~T();
+	free(obj);
+  }
+
+  bool owns(const void *ptr) const { return (ptr >= (const void *)&blocks[0]) && (ptr < (const void *)&blocks[N]); }
+  uint16_t capacity() const { return N; }
+  uint16_t available() const { return N - stats.inUse; }
+  const PoolStats& getStats() const { return stats; }
+};
+
+/*
+ * Bump allocator on a buffer of N bytes. Single objects are never freed, but
+ * everything allocated after a mark is freed at once by reset(mark).
+ *   uint16_t m = arena.mark();
+ *   char *line = (char *)arena.allocate(80);
+ *   ...
+ *   arena.reset(m);
+ */
+template<uint16_t N, bool ISRSafe = false> class Arena {
+private:
+  uint8_t buffer[N];
+  uint16_t top;
+  PoolStats stats;
+
+public:
+  Arena() : top(0) { stats.inUse = stats.peak = stats.failures = 0; }
+
+  void *allocate(const uint16_t size, const uint8_t align = 1) {
+	PoolLock<ISRSafe> lock;
+	const uint16_t start = (top + align - 1) & ~(uint16_t)(align - 1);
+	if ((start < top) || (start > N) || (size > N - start)) {
+	  stats.failures++;
+	  return 0L;
+	}
+	top = start + size;
+	stats.inUse = top;
+	if (top > stats.peak) stats.peak = top;
+	return &buffer[start];
+  }
+
+  template<class T, typename... Args> T *create(Args... args) {
+	void *ptr = allocate(sizeof(T), __alignof__(T));
+	return ptr ? new (ptr) T(args...) : 0L;
+  }
+
+  uint16_t mark() const { return top; }
+  void reset(const uint16_t mark = 0) {
+	PoolLock<ISRSafe> lock;
+	if (mark < top) top = mark;
+	stats.inUse = top;
+  }
+
+  uint16_t capacity() const { return N; }
+  uint16_t available() const { return N - top; }
+  const PoolStats& getStats() const { return stats; }
+};
+
+#endif /* MEMORYPOOL_H */
@@ -0,0 +1,125 @@
+// NAME: Probe.cpp
+//
+// DESC: Cycle accurate timing probes: PROBE(name) measures the enclosing scope
+//       with Timer1 and aggregates count, min, max and sum for each probe site.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// the library always contains the functions, they are only linked if a Sketch
+// with PROBES_ENABLED calls them
+#define PROBES_ENABLED
+#include "Probe.h"
+
+#if defined(__avr__)
+#include <TrappmannRobotics_StringHelper.h>
+#include <util/atomic.h>
+
+static ProbeSite *probeSites = 0L;
+static uint16_t probeOverhead = 0;	// cycles measured by an empty probe
+
+/*
+ * Called from the destructor of ScopedCycleTimer, the overhead of the probe
+ * itself is subtracted.
+ */
+void ProbeSite::record(const uint16_t cycles) {
+  const uint16_t value = (cycles > probeOverhead) ? cycles - probeOverhead : 0;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	if (!linked) {
+	  next = probeSites;
+	  probeSites = this;
+	  linked = true;
+	}
+	count++;
+	sum += value;
+	if (value < min) min = value;
+	if (value > max) max = value;
+	if (histogram) {
+	  uint8_t bin = 0;
+	  for (uint16_t v = value; v; v >>= 1) bin++;
+	  if (histogram[bin] < 0xffff) histogram[bin]++;
+	}
+  }
+}
+
+/*
+ * Timer1 runs in normal mode without prescaler, so TCNT1 counts CPU cycles.
+ * Timer1 can't be used for PWM or the Servo library together with the probes.
+ */
+void beginProbes() {
+  TCCR1A = 0;
+  TCCR1B = (1<<CS10);
+  TIMSK1 = 0;
+
+  // same as an empty ScopedCycleTimer
+  uint16_t overhead = 0xffff;
+  for (uint8_t i = 0; i < 8; i++) {
+	const uint16_t start = TCNT1;
+	const uint16_t cycles = TCNT1 - start;
+	if (cycles < overhead) overhead = cycles;
+  }
+  probeOverhead = overhead;
+}
+
+void resetProbes() {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	for (ProbeSite *site = probeSites; site; site = site->next) {
+	  site->count = site->sum = 0;
+	  site->min = 0xffff;
+	  site->max = 0;
+	  if (site->histogram) {
+		for (uint8_t i = 0; i < PROBE_HISTOGRAM_BINS; i++) site->histogram[i] = 0;
+	  }
+	}
+  }
+}
+
+/*
+ * Print one line per probe site with the durations in CPU cycles, followed by
+ * the non-empty bins of the histogram, ie.
+ * loop: count=1000 min=812 max=2417 mean=903 cycles
+ *   <1024: 980 <2048: 12 <4096: 8
+ */
+void dumpProbes(Print &out) {
+  for (ProbeSite *site = probeSites; site; site = site->next) {
+	ProbeSite copy;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	  copy = *site;
+	}
+	out << (const __FlashStringHelper *)copy.name << F(": count=") << copy.count
+		<< F(" min=") << copy.min << F(" max=") << copy.max
+		<< F(" mean=") << (copy.count ? copy.sum / copy.count : 0) << F(" cycles\n");
+	if (copy.histogram) {
+	  out << ' ';
+	  for (uint8_t i = 0; i < PROBE_HISTOGRAM_BINS; i++) {
+		const uint16_t n = copy.histogram[i];
+		if (n) out << F(" <") << (1UL << i) << F(": ") << n;
+	  }
+	  out << '\n';
+	}
+  }
+}
+
+#endif /* __avr__ */
@@ -0,0 +1,117 @@
+// NAME: Probe.h
+//
+// DESC: Cycle accurate timing probes: PROBE(name) measures the enclosing scope
+//       with Timer1 and aggregates count, min, max and sum for each probe site.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <stdint.h>
+#include <Print.h>
+
+#if defined(__avr__)
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// Number of bins of the optional log2 histogram: 0, 1, 2..3, 4..7, ... 32768..65535 cycles.
+#define PROBE_HISTOGRAM_BINS	17
+
+/*
+ * Statistics of a probe site. The site is a static variable initialized at
+ * compile time and added to the list of all sites with its first record.
+ */
+struct ProbeSite {
+  const char *name;		// in PROGMEM
+  uint16_t *histogram;	// PROBE_HISTOGRAM_BINS counters or 0L
+  ProbeSite *next;
+  uint32_t count;
+  uint32_t sum;
+  uint16_t min;
+  uint16_t max;
+  bool linked;
+
+  void record(const uint16_t cycles);
+};
+
+/*
+ * Measures its lifetime in CPU cycles with Timer1, which runs without prescaler.
+ * Durations are counted modulo 65536 cycles, ie. 4.096ms at 16MHz. A longer
+ * section wraps without notice and is recorded too short, so probe sections
+ * which are shorter for sure.
+ */
+class ScopedCycleTimer {
+private:
+  ProbeSite &site;
+  const uint16_t start;
+
+public:
+  ScopedCycleTimer(ProbeSite &site) : site(site), start(TCNT1) {}
+  ~ScopedCycleTimer() { site.record(TCNT1 - start); }
+};
+
+#if defined(PROBES_ENABLED)
+// Start Timer1 as free running cycle counter and calibrate the probe overhead.
+void beginProbes();
+void resetProbes();
+void dumpProbes(Print &out);
+#endif
+#endif /* __avr__ */
+
+/*
+ * PROBE(name) measures the rest of the enclosing scope, PROBE_HISTOGRAM(name)
+ * additionally keeps a log2 histogram of the durations.
+ *   void loop() {
+ *     PROBE("loop");
+ *     ...
+ *   }
+ * Unless PROBES_ENABLED is defined before including this file, the probes and
+ * beginProbes(), resetProbes() and dumpProbes() compile to nothing, so Timer1
+ * is left alone.
+ */
+#if defined(PROBES_ENABLED) && defined(__avr__)
+#define PROBE_CONCAT2(a, b)	a ## b
+#define PROBE_CONCAT(a, b)	PROBE_CONCAT2(a, b)
+
+#define PROBE_SITE(name, histogram) \
+  static const char PROBE_CONCAT(__probeName, __LINE__)[] PROGMEM = name; \
+  static ProbeSite PROBE_CONCAT(__probeSite, __LINE__) = { PROBE_CONCAT(__probeName, __LINE__), histogram, 0L, 0, 0, 0xffff, 0, false }; \
+  ScopedCycleTimer PROBE_CONCAT(__probeTimer, __LINE__)(PROBE_CONCAT(__probeSite, __LINE__))
+
+#define PROBE(name) PROBE_SITE(name, 0L)
+#define PROBE_HISTOGRAM(name) \
+  static uint16_t PROBE_CONCAT(__probeHistogram, __LINE__)[PROBE_HISTOGRAM_BINS]; \
+  PROBE_SITE(name, PROBE_CONCAT(__probeHistogram, __LINE__))
+#else
+#define PROBE(name)				do {} while (0)
+#define PROBE_HISTOGRAM(name)	do {} while (0)
+#define beginProbes()			do {} while (0)
+#define resetProbes()			do {} while (0)
+#define dumpProbes(out)			do {} while (0)
+#endif
+
+#endif /* PROBE_H */
@@ -0,0 +1,197 @@
+// NAME: Profiler.cpp
+//
+// DESC: Statistical profiler: a Timer2 compare interrupt samples the interrupted
+//       program counter into a histogram of address buckets.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "Profiler.h"
+
+#if defined(__avr__) && defined(TIMER2_COMPA_vect)
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include "BinaryFrame.h"
+
+extern char _etext;
+
+static volatile uint16_t profilerBuckets[PROFILER_BUCKETS];
+static_assert((PROFILER_BUCKETS > 0) && (PROFILER_BUCKETS <= 255), "PROFILER_BUCKETS must be 1..255");
+static uint8_t profilerShift;	// word address >> shift = bucket
+
+/*
+ * Use the smallest prescaler of Timer2 which allows the sample rate in CTC mode.
+ */
+bool Profiler::begin(const uint16_t sampleRate) {
+  static const uint16_t prescalers[] = { 1, 8, 32, 64, 128, 256, 1024 };
+  uint8_t cs = 0;
+  uint32_t top = 0;
+  for (uint8_t i = 0; i < sizeof(prescalers) / sizeof(prescalers[0]); i++) {
+	top = F_CPU / ((uint32_t)prescalers[i] * sampleRate);
+	if ((top > 0) && (top <= 256)) {
+	  cs = i + 1;
+	  break;
+	}
+  }
+  if (0 == cs) return false;
+
+#if FLASHEND > 0xffff
+  const uint32_t words = pgm_get_far_address(_etext) >> 1;
+#else
+  const uint32_t words = ((uint16_t)&_etext) >> 1;
+#endif
+  profilerShift = 0;
+  while (((words - 1) >> profilerShift) >= PROFILER_BUCKETS) profilerShift++;
+  clear();
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	TCCR2A = (1<<WGM21);	// CTC mode
+	TCCR2B = cs;
+	TCNT2 = 0;
+	OCR2A = top - 1;
+	TIFR2 = (1<<OCF2A);
+	TIMSK2 |= (1<<OCIE2A);
+  }
+  return true;
+}
+
+void Profiler::end() {
+  TIMSK2 &= ~(1<<OCIE2A);
+  TCCR2B = 0;
+}
+
+void Profiler::clear() {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) profilerBuckets[i] = 0;
+  }
+}
+
+uint16_t Profiler::getBucket(const uint8_t index) {
+  uint16_t count;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	count = profilerBuckets[index];
+  }
+  return count;
+}
+
+// Size of a bucket in bytes.
+uint16_t Profiler::getBucketSize() {
+  return 2 << profilerShift;
+}
+
+/*
+ * Send the histogram as frames of PROFILER_BUCKETS_PER_FRAME counters:
+ * frame type, shift, number of buckets, index of the first counter, counters.
+ */
+void Profiler::dump(Print &out) {
+  BinaryFrame<3 + 2 * PROFILER_BUCKETS_PER_FRAME> frame;
+  // 16 bit indices, as first would wrap around for more than 224 buckets
+  for (uint16_t first = 0; first < PROFILER_BUCKETS; first += PROFILER_BUCKETS_PER_FRAME) {
+	const uint8_t header[3] = { profilerShift, PROFILER_BUCKETS, (uint8_t)first };
+	frame.begin(PROFILER_FRAME_TYPE);
+	frame.addRaw(header, sizeof(header));
+	for (uint16_t i = first; (i < PROFILER_BUCKETS) && (i < first + PROFILER_BUCKETS_PER_FRAME); i++) {
+	  const uint16_t count = getBucket(i);
+	  frame.addRaw(&count, sizeof(count));
+	}
+	frame.send(out);
+  }
+}
+
+/*
+ * Like the WDT_vect handler in Watchdog.cpp the interrupted program counter is
+ * read from the stack. The ISR is naked, so the offset on the stack is fixed
+ * by the registers pushed here: r31, r30, r25, SREG, r24, followed by the
+ * return address with the high byte first.
+ */
+#if defined(__AVR_3_BYTE_PC__)
+#define PROFILER_PCH_OFFSET	"7"
+#define PROFILER_PCL_OFFSET	"8"
+#else
+#define PROFILER_PCH_OFFSET	"6"
+#define PROFILER_PCL_OFFSET	"7"
+#endif
+
+ISR(TIMER2_COMPA_vect, ISR_NAKED) {
+  __asm__ __volatile__ (
+	"	push r24\n\t"
+	"	in   r24, __SREG__\n\t"
+	"	push r24\n\t"
+	"	push r25\n\t"
+	"	push r30\n\t"
+	"	push r31\n\t"
+	"	in   r30, __SP_L__			; Z = stack pointer\n\t"
+	"	in   r31, __SP_H__\n\t"
+#if defined(__AVR_3_BYTE_PC__)
+	"	ldd  r24, Z+6				; skip code above 128K\n\t"
+	"	tst  r24\n\t"
+	"	brne 3f\n\t"
+#endif
+	"	ldd  r25, Z+" PROFILER_PCH_OFFSET "	; word address of the interrupted code\n\t"
+	"	ldd  r24, Z+" PROFILER_PCL_OFFSET "\n\t"
+
+	"	lds  r30, %[SHIFT]			; bucket = word address >> shift\n\t"
+	"1:	tst  r30\n\t"
+	"	breq 2f\n\t"
+	"	lsr  r25\n\t"
+	"	ror  r24\n\t"
+	"	dec  r30\n\t"
+	"	rjmp 1b\n\t"
+
+	"2:	tst  r25					; skip addresses above _etext, ie. the bootloader,\n\t"
+	"	brne 3f						; r1 is not known to be zero here\n\t"
+	"	cpi  r24, %[BUCKETS]\n\t"
+	"	brsh 3f\n\t"
+	"	lsl  r24					; Z = &profilerBuckets[bucket]\n\t"
+	"	rol  r25\n\t"
+	"	ldi  r30, lo8(%[HISTOGRAM])\n\t"
+	"	ldi  r31, hi8(%[HISTOGRAM])\n\t"
+	"	add  r30, r24\n\t"
+	"	adc  r31, r25\n\t"
+	"	ld   r24, Z\n\t"
+	"	ldd  r25, Z+1\n\t"
+	"	adiw r24, 1					; increment, but stop at 0xffff\n\t"
+	"	breq 3f\n\t"
+	"	st   Z, r24\n\t"
+	"	std  Z+1, r25\n\t"
+
+	"3:	pop  r31\n\t"
+	"	pop  r30\n\t"
+	"	pop  r25\n\t"
+	"	pop  r24\n\t"
+	"	out  __SREG__, r24\n\t"
+	"	pop  r24\n\t"
+	"	reti\n\t"
+	: /* output */
+	: /* input */
+	  [SHIFT]     "m" (profilerShift),
+	  [BUCKETS]   "M" (PROFILER_BUCKETS),
+	  [HISTOGRAM] "i" (profilerBuckets)
+  );
+}
+
+#endif /* __avr__ && TIMER2_COMPA_vect */
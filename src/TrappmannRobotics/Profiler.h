@@ -0,0 +1,76 @@
+// NAME: Profiler.h
+//
+// DESC: Statistical profiler: a Timer2 compare interrupt samples the interrupted
+//       program counter into a histogram of address buckets.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#if defined(__avr__)
+#include <avr/io.h>	// defines TIMER2_COMPA_vect on parts with Timer2
+#endif
+
+#if defined(__avr__) && defined(TIMER2_COMPA_vect)
+#include <stdint.h>
+#include <Print.h>
+
+// Number of 16-bit counters of the histogram, at most 255.
+#ifndef PROFILER_BUCKETS
+#define PROFILER_BUCKETS	128
+#endif
+
+// Frame type of the histogram frames, see BinaryFrame.
+#define PROFILER_FRAME_TYPE	0xfd
+
+// Number of counters sent in each frame.
+#define PROFILER_BUCKETS_PER_FRAME	32
+
+/*
+ * The flash up to _etext is divided into PROFILER_BUCKETS buckets of equal size,
+ * a power of two. With each interrupt the bucket holding the interrupted program
+ * counter is incremented, counters stop at 0xffff. The histogram is sent by dump()
+ * as binary frames and mapped to symbols on the host by extras/profile.py.
+ * Timer2 can't be used for tone() or PWM on its pins while profiling.
+ */
+class Profiler {
+private:
+  Profiler() {}
+
+public:
+  static bool begin(const uint16_t sampleRate = 1000);
+  static void end();
+  static void clear();
+
+  static uint16_t getBucket(const uint8_t index);
+  static uint16_t getBucketSize();
+  static void dump(Print &out);
+};
+
+#endif /* __avr__ && TIMER2_COMPA_vect */
+
+#endif /* PROFILER_H */
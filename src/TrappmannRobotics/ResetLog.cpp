@@ -0,0 +1,141 @@
+// NAME: ResetLog.cpp
+//
+// DESC: Wear leveled history of resets in the EEPROM: a circular log of boot
+//       records with sequence numbers, the newest is found by binary search.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "ResetLog.h"
+
+#if defined(__avr__)
+#include <stddef.h>
+#include <Arduino.h>
+#include <avr/eeprom.h>
+#include <TrappmannRobotics_System.h>
+#include <TrappmannRobotics_StringHelper.h>
+
+uint16_t ResetLog::readSeq(const uint8_t slot) const {
+  return eeprom_read_word((const uint16_t *)slotAddr(slot));
+}
+
+/*
+ * A slot belongs to the current pass, if its sequence number is the one of
+ * slot 0 plus its index. This is true for the slots up to the newest and false
+ * after it, as they are empty or hold older sequence numbers.
+ */
+void ResetLog::begin() {
+  count = 0;
+  seq = RESETLOG_SEQ_EMPTY;
+  const uint16_t first = readSeq(0);
+  if (RESETLOG_SEQ_EMPTY == first) return;
+
+  uint8_t low = 0;			// belongs to the current pass
+  uint8_t high = slots;		// first slot, which does not
+  while (high - low > 1) {
+	const uint8_t mid = low + (high - low) / 2;
+	const uint16_t s = readSeq(mid);
+	if ((RESETLOG_SEQ_EMPTY != s) && ((s + RESETLOG_SEQ_MOD - first) % RESETLOG_SEQ_MOD == mid)) low = mid;
+	else high = mid;
+  }
+  newest = low;
+  seq = readSeq(low);
+
+  // all slots are used, if the slot after the newest is not empty
+  const uint8_t next = (newest + 1 < slots) ? newest + 1 : 0;
+  count = ((0 != next) && (RESETLOG_SEQ_EMPTY == readSeq(next))) ? newest + 1 : slots;
+}
+
+void ResetLog::logBoot() {
+  // complete the record of the previous run
+  if ((count > 0) && System::hasCrashRecord()) {
+	const CrashRecord &crash = System::getCrashRecord();
+	const uint16_t prev = slotAddr(newest);
+	eeprom_update_dword((uint32_t *)(prev + offsetof(ResetRecord, crashPC)), crash.pc);
+	eeprom_update_dword((uint32_t *)(prev + offsetof(ResetRecord, uptime)), crash.millis);
+  }
+
+  ResetRecord record;
+  record.seq = (RESETLOG_SEQ_EMPTY == seq) ? 0 : (seq + 1) % RESETLOG_SEQ_MOD;
+  record.resetFlags = System::getResetFlags();
+  record.crashPC = 0;
+  record.uptime = 0;
+
+  const uint8_t slot = ((RESETLOG_SEQ_EMPTY == seq) || (newest + 1 >= slots)) ? 0 : newest + 1;
+  const uint16_t a = slotAddr(slot);
+  eeprom_update_block(&record.resetFlags, (void *)(a + offsetof(ResetRecord, resetFlags)),
+					  sizeof(record) - offsetof(ResetRecord, resetFlags));
+  eeprom_update_word((uint16_t *)a, record.seq);
+
+  newest = slot;
+  seq = record.seq;
+  if (count < slots) count++;
+}
+
+void ResetLog::updateUptime() {
+  if (RESETLOG_SEQ_EMPTY == seq) return;
+  eeprom_update_dword((uint32_t *)(slotAddr(newest) + offsetof(ResetRecord, uptime)), millis());
+}
+
+bool ResetLog::read(const uint8_t age, ResetRecord &record) const {
+  if (age >= count) return false;
+  const uint8_t slot = (newest >= age) ? newest - age : newest + slots - age;
+  eeprom_read_block(&record, (const void *)slotAddr(slot), sizeof(record));
+  return true;
+}
+
+uint8_t ResetLog::countByFlag(const uint8_t flagMask) const {
+  uint8_t n = 0;
+  ResetRecord record;
+  for (uint8_t age = 0; read(age, record); age++) {
+	if (record.resetFlags & flagMask) n++;
+  }
+  return n;
+}
+
+/*
+ * Print the records from the newest to the oldest, ie.
+ * #41 flags=0b00001000 uptime=3600000 ms PC=0x00000a3c
+ */
+void ResetLog::print(Print &out) const {
+  ResetRecord record;
+  for (uint8_t age = 0; read(age, record); age++) {
+	out << '#' << record.seq << F(" flags=0b") << bin8(record.resetFlags)
+		<< F(" uptime=") << record.uptime << F(" ms PC=0x") << hex32(record.crashPC) << '\n';
+  }
+}
+
+/*
+ * Only the sequence numbers are erased.
+ */
+void ResetLog::clear() {
+  for (uint8_t slot = 0; slot < slots; slot++) {
+	eeprom_update_word((uint16_t *)slotAddr(slot), RESETLOG_SEQ_EMPTY);
+  }
+  newest = count = 0;
+  seq = RESETLOG_SEQ_EMPTY;
+}
+
+#endif /* __avr__ */
@@ -0,0 +1,100 @@
+// NAME: ResetLog.h
+//
+// DESC: Wear leveled history of resets in the EEPROM: a circular log of boot
+//       records with sequence numbers, the newest is found by binary search.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef RESETLOG_H
+#define RESETLOG_H
+
+#if defined(__avr__)
+#include <stdint.h>
+#include <Print.h>
+
+// Sequence numbers count modulo RESETLOG_SEQ_MOD, 0xffff marks an empty slot.
+#define RESETLOG_SEQ_EMPTY	0xffff
+#define RESETLOG_SEQ_MOD	0xffffUL
+
+/*
+ * One run of the Sketch: the reset flags at its start, and the time it ran and
+ * the program counter of a crash, if captured by System::captureCrash().
+ */
+struct ResetRecord {
+  uint16_t seq;
+  uint8_t resetFlags;
+  uint32_t crashPC;		// 0 if unknown
+  uint32_t uptime;		// in ms, 0 if unknown
+} __attribute__ ((packed));
+
+/*
+ * The log uses slots records of the EEPROM starting at addr. A new record is
+ * written to the slot after the newest, so each cell is written once per pass
+ * through the region. The sequence number is written last and makes the record
+ * valid. The slots 0..n hold consecutive sequence numbers starting at the one in
+ * slot 0, so the newest record is found by binary search.
+ */
+class ResetLog {
+private:
+  const uint16_t addr;
+  const uint8_t slots;
+  uint8_t newest;
+  uint8_t count;
+  uint16_t seq;
+
+public:
+  ResetLog(const uint16_t addr, const uint8_t slots) : addr(addr), slots(slots), newest(0), count(0), seq(RESETLOG_SEQ_EMPTY) {}
+
+  // Find the newest record.
+  void begin();
+
+  // Append the record of this run and complete the previous one from the crash
+  // record of the System, if available. Writes up to 11 bytes per boot (9 of the
+  // record and 2 of the sequence number) plus up to 8 bytes of the previous record
+  // after a crash. Only changed bytes are written.
+  void logBoot();
+
+  // Store the uptime of this run into the newest record. Each call writes up to 4
+  // bytes into the same cells, so call it once an hour at most: a cell endures
+  // about 100000 writes, ie. 11 years at one write per hour.
+  void updateUptime();
+
+  uint8_t getCount() const { return count; }
+  // Read a record by its age, 0 is the newest.
+  bool read(const uint8_t age, ResetRecord &record) const;
+  // Count the records with the given bit of the reset flags, ie. (1<<WDRF).
+  uint8_t countByFlag(const uint8_t flagMask) const;
+  void print(Print &out) const;
+  void clear();
+
+private:
+  uint16_t slotAddr(const uint8_t slot) const { return addr + slot * sizeof(ResetRecord); }
+  uint16_t readSeq(const uint8_t slot) const;
+};
+
+#endif /* __avr__ */
+
+#endif /* RESETLOG_H */
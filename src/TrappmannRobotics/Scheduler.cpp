@@ -0,0 +1,167 @@
+// NAME: Scheduler.cpp
+//
+// DESC: Cooperative scheduler for periodic tasks, ordered by a min-heap of their
+//       next run time, with run time and lateness statistics and watchdog accounting.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "Scheduler.h"
+#include <Arduino.h>
+#include <TrappmannRobotics_StringHelper.h>
+#if defined(ARDUINO_ARCH_AVR)
+#include "Watchdog.h"
+#endif
+
+int8_t SchedulerBase::addTask(TaskFunc func, const uint32_t period, const uint32_t offset, const uint32_t deadline) {
+  if (count >= capacity) return -1;
+
+  const uint8_t id = count;
+  Task &task = tasks[id];
+  task.func = func;
+  task.period = period;
+  task.nextRun = millis() + offset;
+  task.deadline = deadline ? deadline : 2 * period;
+  task.lastRun = task.nextRun;	// deadline counts from the first run
+  task.enabled = true;
+  task.runs = task.totalRunTime = 0;
+  task.maxRunTime = task.maxLateness = 0;
+
+  heap[count++] = id;
+  siftUp(id);
+  return id;
+}
+
+/*
+ * A disabled task stays in the heap, but is skipped and does not count for the
+ * watchdog.
+ */
+void SchedulerBase::enableTask(const uint8_t id, const bool enabled) {
+  if (id >= count) return;
+  if (enabled && !tasks[id].enabled) tasks[id].lastRun = millis();
+  tasks[id].enabled = enabled;
+}
+
+/*
+ * Times are compared by their difference, so the overflow of millis() after
+ * 49 days does not matter.
+ */
+bool SchedulerBase::before(const uint8_t a, const uint8_t b) const {
+  return (int32_t)(tasks[heap[a]].nextRun - tasks[heap[b]].nextRun) < 0;
+}
+
+void SchedulerBase::siftUp(uint8_t pos) {
+  while (pos > 0) {
+	const uint8_t parent = (pos - 1) / 2;
+	if (!before(pos, parent)) break;
+	const uint8_t tmp = heap[pos]; heap[pos] = heap[parent]; heap[parent] = tmp;
+	pos = parent;
+  }
+}
+
+void SchedulerBase::siftDown(uint8_t pos) {
+  for (;;) {
+	uint8_t first = pos;
+	const uint8_t left = 2 * pos + 1;
+	const uint8_t right = left + 1;
+	if ((left < count) && before(left, first)) first = left;
+	if ((right < count) && before(right, first)) first = right;
+	if (first == pos) break;
+	const uint8_t tmp = heap[pos]; heap[pos] = heap[first]; heap[first] = tmp;
+	pos = first;
+  }
+}
+
+/*
+ * Only the task at the top of the heap is checked, so run() takes the same time
+ * for any number of tasks. If a task is late by more than a period, the missed
+ * runs are skipped instead of running it several times in a row.
+ */
+uint32_t SchedulerBase::run() {
+  if (0 == count) return 0;
+
+  uint32_t now = millis();
+  Task &task = tasks[heap[0]];
+  int32_t wait = task.nextRun - now;
+  if (wait <= 0) {
+	if (task.enabled) {
+	  const uint32_t lateness = -wait;
+	  if (lateness > task.maxLateness) task.maxLateness = (lateness > 0xffff) ? 0xffff : lateness;
+
+	  const uint32_t start = micros();
+	  task.func();
+	  const uint32_t runTime = micros() - start;
+	  task.totalRunTime += runTime;
+	  if (runTime > task.maxRunTime) task.maxRunTime = (runTime > 0xffff) ? 0xffff : runTime;
+	  task.runs++;
+	  now = millis();
+	  task.lastRun = now;
+	}
+	task.nextRun += task.period;
+	if ((int32_t)(task.nextRun - now) < 0) task.nextRun = now + task.period;
+	siftDown(0);
+	wait = tasks[heap[0]].nextRun - now;
+  }
+
+  if (watchdog && allTasksAlive()) {
+#if defined(ARDUINO_ARCH_AVR)
+	Watchdog::watchdogReset();
+#endif
+  }
+  return (wait > 0) ? wait : 0;
+}
+
+/*
+ * Every enabled task must have run within its deadline.
+ */
+bool SchedulerBase::allTasksAlive() const {
+  const uint32_t now = millis();
+  for (uint8_t id = 0; id < count; id++) {
+	const Task &task = tasks[id];
+	if (task.enabled && ((int32_t)(now - task.lastRun) > (int32_t)task.deadline)) return false;
+  }
+  return true;
+}
+
+void SchedulerBase::resetStats() {
+  for (uint8_t id = 0; id < count; id++) {
+	tasks[id].runs = tasks[id].totalRunTime = 0;
+	tasks[id].maxRunTime = tasks[id].maxLateness = 0;
+  }
+}
+
+/*
+ * Print one line per task, ie.
+ * task 0: period=10 ms runs=1000 run time mean=312 max=420 us, max late=1 ms
+ */
+void SchedulerBase::dump(Print &out) const {
+  for (uint8_t id = 0; id < count; id++) {
+	const Task &task = tasks[id];
+	out << F("task ") << id << F(": period=") << task.period << F(" ms runs=") << task.runs
+		<< F(" run time mean=") << (task.runs ? task.totalRunTime / task.runs : 0)
+		<< F(" max=") << task.maxRunTime << F(" us, max late=") << task.maxLateness
+		<< (task.enabled ? F(" ms\n") : F(" ms, disabled\n"));
+  }
+}
@@ -0,0 +1,112 @@
+// NAME: Scheduler.h
+//
+// DESC: Cooperative scheduler for periodic tasks, ordered by a min-heap of their
+//       next run time, with run time and lateness statistics and watchdog accounting.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <Print.h>
+
+typedef void (*TaskFunc)();
+
+/*
+ * A periodic task and its statistics. Times are in ms, except the run time
+ * which is measured in us.
+ */
+struct Task {
+  TaskFunc func;
+  uint32_t period;
+  uint32_t nextRun;
+  uint32_t deadline;		// maximum time between two runs
+  uint32_t lastRun;
+  uint32_t runs;
+  uint32_t totalRunTime;
+  uint16_t maxRunTime;
+  uint16_t maxLateness;
+  bool enabled;
+};
+
+/*
+ * The task table and the heap are provided by the template Scheduler<N>, so
+ * the code is shared between schedulers of different sizes.
+ */
+class SchedulerBase {
+private:
+  Task *tasks;
+  uint8_t *heap;		// task ids, the task due first at heap[0]
+  const uint8_t capacity;
+  uint8_t count;
+  bool watchdog;
+
+protected:
+  SchedulerBase(Task *tasks, uint8_t *heap, const uint8_t capacity)
+	: tasks(tasks), heap(heap), capacity(capacity), count(0), watchdog(false) {}
+
+public:
+  // Returns the id of the task or -1, if the table is full. The task runs first
+  // after offset ms. The deadline defaults to twice the period.
+  int8_t addTask(TaskFunc func, const uint32_t period, const uint32_t offset = 0, const uint32_t deadline = 0);
+  void enableTask(const uint8_t id, const bool enabled = true);
+
+  // Kick Watchdog::watchdogReset() from run(), while all tasks meet their deadline.
+  void useWatchdog(const bool enabled = true) { watchdog = enabled; }
+
+  // Run the task due first, if any, and return the ms until the next task is due.
+  uint32_t run();
+
+  bool allTasksAlive() const;
+  uint8_t getTaskCount() const { return count; }
+  const Task& getTask(const uint8_t id) const { return tasks[id]; }
+  void resetStats();
+  void dump(Print &out) const;
+
+private:
+  bool before(const uint8_t a, const uint8_t b) const;
+  void siftDown(uint8_t pos);
+  void siftUp(uint8_t pos);
+};
+
+/*
+ * Scheduler for up to N tasks, ie.
+ *   Scheduler<4> scheduler;
+ *   scheduler.addTask(readSensors, 10);
+ *   scheduler.addTask(updateDisplay, 500, 5);
+ *   void loop() { scheduler.run(); }
+ */
+template<uint8_t N> class Scheduler : public SchedulerBase {
+private:
+  Task taskTable[N];
+  uint8_t taskHeap[N];
+
+public:
+  Scheduler() : SchedulerBase(taskTable, taskHeap, N) {}
+};
+
+#endif /* SCHEDULER_H */
@@ -0,0 +1,104 @@
+// NAME: StackMonitor.cpp
+//
+// DESC: Stack high water mark by stack painting: the free RAM between heap and
+//       stack is filled with a canary at startup, a scan finds the deepest excursion.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "StackMonitor.h"
+
+#if defined(__avr__)
+#include <stdlib.h>
+#include <avr/io.h>
+#include <util/atomic.h>
+
+extern char *__brkval;
+
+static const uint16_t *cursor = 0L;		// position of a running scan
+static const uint8_t *lowWater = 0L;	// lowest address reached by the stack
+static uint16_t minHeadroom = 0xffff;
+
+static uint8_t *heapTop() {
+  return (uint8_t *)(__brkval ? __brkval : __malloc_heap_start);
+}
+
+/*
+ * The scan runs word-wise upwards from the top of the heap and stops at the
+ * first word which is not painted. If the heap grew into a running scan, it
+ * starts again.
+ */
+bool StackMonitor::scanStep(const uint8_t words) {
+  const uint8_t *start = heapTop();
+  if (!cursor || ((const uint8_t *)cursor < start)) cursor = (const uint16_t *)start;
+
+  const uint16_t *end = (const uint16_t *)SP;
+  for (uint8_t i = 0; i < words; i++) {
+	if ((cursor >= end) || (STACK_CANARY_WORD != *cursor)) {
+	  const uint16_t headroom = (const uint8_t *)cursor - start;
+	  if (headroom < minHeadroom) minHeadroom = headroom;
+	  if (!lowWater || ((const uint8_t *)cursor < lowWater)) lowWater = (const uint8_t *)cursor;
+	  cursor = 0L;
+	  return true;
+	}
+	cursor++;
+  }
+  return false;
+}
+
+uint16_t StackMonitor::getStackHeadroom() {
+  cursor = 0L;
+  while (!scanStep(255));
+  return minHeadroom;
+}
+
+uint16_t StackMonitor::getMinHeadroom() {
+  return minHeadroom;
+}
+
+/*
+ * Number of bytes between the end of RAM and the deepest stack excursion
+ * found by the last scans.
+ */
+uint16_t StackMonitor::getMaxStackUsage() {
+  return lowWater ? (RAMEND + 1) - (uint16_t)lowWater : 0;
+}
+
+/*
+ * Interrupts are disabled, as an ISR would place its stack frame right into
+ * the painted region.
+ */
+void StackMonitor::repaint() {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	uint8_t *p = heapTop();
+	uint8_t *end = (uint8_t *)SP;
+	while (p < end) *p++ = STACK_CANARY;
+	cursor = 0L;
+	lowWater = 0L;
+	minHeadroom = 0xffff;
+  }
+}
+
+#endif /* __avr__ */
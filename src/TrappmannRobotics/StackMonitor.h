@@ -0,0 +1,99 @@
+// NAME: StackMonitor.h
+//
+// DESC: Stack high water mark by stack painting: the free RAM between heap and
+//       stack is filled with a canary, a scan finds the deepest excursion.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef STACKMONITOR_H
+#define STACKMONITOR_H
+
+#if defined(__avr__)
+#include <stdint.h>
+
+// Pattern painted into the free RAM.
+#define STACK_CANARY		0xc5
+#define STACK_CANARY_WORD	0xc5c5
+
+/*
+ * The free RAM from the end of the static data up to the stack is painted with
+ * STACK_CANARY by repaint() or, with TRAPPMANNROBOTICS_STACK_PAINT, in section
+ * .init3, before the static data is initialized. The canary is only overwritten by the stack or by the heap, so the first word
+ * above the heap which is not a canary shows the deepest stack excursion.
+ * The scan is conservative: memory which was returned from the top of the heap
+ * by free() is no longer painted and counts as used.
+ */
+class StackMonitor {
+private:
+  StackMonitor() {}
+
+public:
+  // Scan all at once and return the minimum number of free bytes ever.
+  static uint16_t getStackHeadroom();
+
+  // Scan up to words words. Returns true, if the scan is complete and the
+  // result is available by getMinHeadroom(). Call it from loop() to spread
+  // the scan over several loops.
+  static bool scanStep(const uint8_t words = 32);
+
+  static uint16_t getMinHeadroom();
+  static uint16_t getMaxStackUsage();
+
+  // Paint the free RAM again to measure the next part of the Sketch on its own.
+  // Interrupts are disabled while painting.
+  static void repaint();
+};
+
+/*
+ * Put TRAPPMANNROBOTICS_STACK_PAINT once into the Sketch to paint the RAM from
+ * _end up to the stack pointer at startup, so the stack usage since the reset
+ * is measured. Like the resetFlagsInit trick in TrappmannRobotics_System.cpp
+ * the code is placed in an .init section, so it runs before main(). In .init3
+ * the stack pointer and __zero_reg__ are already set up, but nothing is on the
+ * stack yet and the .noinit section below _end is not touched. The naked
+ * function contains basic asm only, so the canary is given as number. Without
+ * the macro nothing is painted before the first repaint().
+ */
+#define TRAPPMANNROBOTICS_STACK_PAINT \
+  void stackPaintInit(void) __attribute__ ((naked, used)) __attribute__ ((section(".init3"))); \
+  void stackPaintInit(void) { \
+	__asm__ __volatile__ ( \
+	  "	ldi  r30, lo8(_end)		; Z = start of free RAM\n\t" \
+	  "	ldi  r31, hi8(_end)\n\t" \
+	  "	ldi  r24, 0xc5			; STACK_CANARY\n\t" \
+	  "	in   r26, __SP_L__		; X = stack pointer\n\t" \
+	  "	in   r27, __SP_H__\n\t" \
+	  "1:	st   Z+, r24			; paint up to the stack pointer\n\t" \
+	  "	cp   r30, r26\n\t" \
+	  "	cpc  r31, r27\n\t" \
+	  "	brlo 1b\n\t" \
+	); \
+  } \
+  extern void stackPaintInit(void)
+
+#endif /* __avr__ */
+
+#endif /* STACKMONITOR_H */
@@ -0,0 +1,47 @@
+// NAME: TokenLog.cpp
+//
+// DESC: Tokenized logging: only the ID of the format string and the raw binary
+//       arguments are sent, the text is restored on the host by extras/tokenlog.py.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "TokenLog.h"
+
+#if defined(__avr__)
+#include <string.h>
+
+Print *TokenLog::out = 0L;
+BinaryFrame<2 + TOKENLOG_MAX_ARGS> TokenLog::frame;
+
+/*
+ * Copy the string including the terminating NUL. If it does not fit, the frame
+ * is marked as overflowed and the host shows the record as truncated.
+ */
+void TokenLog::addArg(const char *value) {
+  frame.addRaw(value, strlen(value) + 1);
+}
+
+#endif /* __avr__ */
@@ -0,0 +1,104 @@
+// NAME: TokenLog.h
+//
+// DESC: Tokenized logging: only the ID of the format string and the raw binary
+//       arguments are sent, the text is restored on the host by extras/tokenlog.py.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef TOKENLOG_H
+#define TOKENLOG_H
+
+#if defined(__avr__)
+#include <stdint.h>
+#include <Print.h>
+#include <TrappmannRobotics/BinaryFrame.h>
+
+// Frame type of a log record, see BinaryFrame.
+#define TOKENLOG_FRAME_TYPE	0xfe
+
+// Maximum size of the arguments of a single log statement.
+#define TOKENLOG_MAX_ARGS	24
+
+/*
+ * The format strings are placed in a section which is not loaded to the target,
+ * so they cost no flash memory. The offset of a string in this section is its ID.
+ * The trailing ';' comments out the section flags added by the compiler.
+ */
+#define TOKENLOG_SECTION	".trlog,\"\",@progbits ;"
+
+/*
+ * Log with a printf like format string, ie. TLOG("speed=%d pos=%ld", speed, pos);
+ * Arguments are sent with the default argument promotions of printf on AVR:
+ * 8-bit values as 16-bit, float and double as 4 byte float. Strings (%s) are
+ * copied including the terminating NUL.
+ */
+#define TLOG(fmt, ...) do { \
+  static const char __tokenLogFormat[] __attribute__((section(TOKENLOG_SECTION), used)) = fmt; \
+  TokenLog::log((uint16_t)(uintptr_t)__tokenLogFormat, ##__VA_ARGS__); \
+} while (0)
+
+class TokenLog {
+private:
+  TokenLog() {}
+
+  static Print *out;
+  static BinaryFrame<2 + TOKENLOG_MAX_ARGS> frame;
+
+public:
+  static void begin(Print &out) { TokenLog::out = &out; }
+
+  template<typename... Args> static void log(const uint16_t id, const Args... args) {
+	if (!out) return;
+	frame.begin(TOKENLOG_FRAME_TYPE);
+	frame.addRaw(&id, sizeof(id));
+	addArgs(args...);
+	frame.send(*out);
+  }
+
+private:
+  static void addArgs() {}
+  template<typename T, typename... Rest> static void addArgs(const T first, const Rest... rest) {
+	addArg(first);
+	addArgs(rest...);
+  }
+
+  static void addArg(const int16_t value)   { frame.addRaw(&value, sizeof(value)); }
+  static void addArg(const uint16_t value)  { frame.addRaw(&value, sizeof(value)); }
+  static void addArg(const int32_t value)   { frame.addRaw(&value, sizeof(value)); }
+  static void addArg(const uint32_t value)  { frame.addRaw(&value, sizeof(value)); }
+  static void addArg(const char value)      { addArg((int16_t)value); }
+  static void addArg(const int8_t value)    { addArg((int16_t)value); }
+  static void addArg(const uint8_t value)   { addArg((uint16_t)value); }
+  static void addArg(const bool value)      { addArg((uint16_t)value); }
+  static void addArg(const float value)     { frame.addRaw(&value, sizeof(value)); }
+  static void addArg(const double value)    { addArg((float)value); }
+  static void addArg(const void *value)     { addArg((uint16_t)(uintptr_t)value); }
+  static void addArg(const char *value);
+};
+
+#endif /* __avr__ */
+
+#endif /* TOKENLOG_H */
@@ -147,6 +147,8 @@ ISR(WDT_vect) // Watchdog timer interrupt.
       "r24", "r25", "r26"
   );
   uint32_t irqPC = ((((uint32_t)IND) << 16) | (((uint16_t)PCH) << 8) | PCL) << 1;  // convert word-ptr to byte-ptr
+  // interrupt mode without reset, ie. the fault code blinking of System::haltLowPower()
+  if (!(WDTCSR & (1<<WDE))) return;
   if (_watchdogCallbackFunc) _watchdogCallbackFunc(irqPC);
   while(1); // wait for 2nd interrupt to reset the system
 }
@@ -2,6 +2,9 @@
 //
 // DESC: Helper methods for printing debugging information through the Serial interface.
 //       Printing must be enabled by a "#define DEBUG 1" before including this header.
+//       Leveled logging with LOG_ERROR .. LOG_TRACE is configured by LOG_LEVEL and the
+//       module masks LOG_MODULE, LOG_MODULES and LOG_TRACE_MODULES, which must also be
+//       defined before including this header.
 //
 // This file is part of the TrappmannRobotics-Library for the Arduino environment.
 // https://github.com/ATrappmann/TrappmannRobotics-Library
@@ -33,10 +36,84 @@
 
 #include <TrappmannRobotics_StringHelper.h>
 
+#define LOG_LEVEL_NONE   0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_WARN   2
+#define LOG_LEVEL_INFO   3
+#define LOG_LEVEL_DEBUG  4
+#define LOG_LEVEL_TRACE  5
+
+// Highest level which is printed. "#define DEBUG" enables all levels up to DEBUG.
+#ifndef LOG_LEVEL
 #ifdef DEBUG
-#define SEROUT(msg)  Serial << msg
+#define LOG_LEVEL LOG_LEVEL_DEBUG
 #else
-#define SEROUT(msg)
+#define LOG_LEVEL LOG_LEVEL_NONE
+#endif
+#endif
+
+// Bit of the module this source file belongs to.
+#ifndef LOG_MODULE
+#define LOG_MODULE 0x0001
+#endif
+
+// Bit mask of the modules which are allowed to print at all.
+#ifndef LOG_MODULES
+#define LOG_MODULES 0xffff
+#endif
+
+// Bit mask of the modules which print up to TRACE regardless of LOG_LEVEL.
+#ifndef LOG_TRACE_MODULES
+#define LOG_TRACE_MODULES 0x0000
 #endif
 
+// Print object all messages are sent to.
+#ifndef LOG_OUTPUT
+#define LOG_OUTPUT Serial
+#endif
+
+/*
+ * The levels are resolved by the preprocessor, so disabled statements produce
+ * neither code nor strings in flash memory.
+ */
+#if (LOG_MODULE & LOG_MODULES) && (LOG_MODULE & LOG_TRACE_MODULES)
+#define LOG_MAX_LEVEL LOG_LEVEL_TRACE
+#elif (LOG_MODULE & LOG_MODULES)
+#define LOG_MAX_LEVEL LOG_LEVEL
+#else
+#define LOG_MAX_LEVEL LOG_LEVEL_NONE
+#endif
+
+#if LOG_MAX_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(msg)  do { LOG_OUTPUT << msg; } while (0)
+#else
+#define LOG_ERROR(msg)  do {} while (0)
+#endif
+
+#if LOG_MAX_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(msg)   do { LOG_OUTPUT << msg; } while (0)
+#else
+#define LOG_WARN(msg)   do {} while (0)
+#endif
+
+#if LOG_MAX_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(msg)   do { LOG_OUTPUT << msg; } while (0)
+#else
+#define LOG_INFO(msg)   do {} while (0)
+#endif
+
+#if LOG_MAX_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(msg)  do { LOG_OUTPUT << msg; } while (0)
+#else
+#define LOG_DEBUG(msg)  do {} while (0)
+#endif
+
+#if LOG_MAX_LEVEL >= LOG_LEVEL_TRACE
+#define LOG_TRACE(msg)  do { LOG_OUTPUT << msg; } while (0)
+#else
+#define LOG_TRACE(msg)  do {} while (0)
+#endif
+
+#define SEROUT(msg)  LOG_DEBUG(msg)
+
 #endif /* DEBUG_H */
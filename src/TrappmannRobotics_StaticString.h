@@ -0,0 +1,100 @@
+// NAME: StaticString.h
+//
+// DESC: String class with a fixed capacity and inline storage, which never uses the
+//       heap. Text is appended with the stream operator or the Print methods.
+//
+// This file is part of the TrappmannRobotics-Library for the Arduino environment.
+// https://github.com/ATrappmann/TrappmannRobotics-Library
+//
+// MIT License
+//
+// Copyright (c) 2026 Andreas Trappmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef STATICSTRING_H
+#define STATICSTRING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <Print.h>
+
+/*
+ * A StaticString<N> holds up to N characters plus the terminating NUL.
+ * Text exceeding the capacity is cut off and flagged by getWriteError().
+ */
+template<uint8_t N> class StaticString : public Print {
+private:
+  char buffer[N+1];
+  uint8_t len;
+
+public:
+  StaticString() : len(0) { buffer[0] = '\0'; }
+  StaticString(const char *str) : len(0) { buffer[0] = '\0'; write(str); }
+  StaticString(const __FlashStringHelper *str) : len(0) { buffer[0] = '\0'; print(str); }
+
+  StaticString& operator =(const char *str) { clear(); write(str); return *this; }
+
+  virtual size_t write(uint8_t c) {
+	if (len >= N) {
+	  setWriteError();
+	  return 0;
+	}
+	buffer[len++] = c;
+	buffer[len] = '\0';
+	return 1;
+  }
+
+  virtual size_t write(const uint8_t *data, size_t size) {
+	if (size > (size_t)(N - len)) {
+	  size = N - len;
+	  setWriteError();
+	}
+	memcpy(&buffer[len], data, size);
+	len += size;
+	buffer[len] = '\0';
+	return size;
+  }
+  using Print::write;
+
+  void clear() {
+	len = 0;
+	buffer[0] = '\0';
+	clearWriteError();
+  }
+
+  const char *c_str() const { return buffer; }
+  uint8_t length() const { return len; }
+  static uint8_t capacity() { return N; }
+
+  char operator [](const uint8_t index) const { return (index < len) ? buffer[index] : '\0'; }
+  bool operator ==(const char *str) const { return 0 == strcmp(buffer, str); }
+  bool operator !=(const char *str) const { return 0 != strcmp(buffer, str); }
+
+  StaticString substring(uint8_t from, uint8_t to = N) const {
+	StaticString result;
+	if (to > len) to = len;
+	if (from < to) result.write((const uint8_t *)&buffer[from], to - from);
+	return result;
+  }
+};
+
+template<uint8_t N> inline Print& operator <<(Print &obj, const StaticString<N> &arg) { obj.write(arg.c_str(), arg.length()); return obj; }
+
+#endif /* STATICSTRING_H */
@@ -29,61 +29,450 @@
 // SOFTWARE.
 //
 #include <TrappmannRobotics_StringHelper.h>
+#include <string.h>
 
+static const uint32_t powersOfTen[] PROGMEM = {
+  1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+static const uint16_t powersOfTen16[] PROGMEM = {
+  1, 10, 100, 1000, 10000
+};
+
+/*
+ * The decimal kernels subtract powers of ten from the value instead of dividing
+ * by 10, because an 8-bit core has no divide instruction. Each kernel uses
+ * arithmetic of its own width and hands the remainder over to a smaller one
+ * as soon as it fits.
+ */
+char *formatDec(char *dst, uint8_t value) {
+  char *p = dst;
+  if (value >= 10) {
+	if (value >= 100) {
+	  char digit = '0';
+	  do {
+		value -= 100;
+		digit++;
+	  } while (value >= 100);
+	  *p++ = digit;
+	}
+	char digit = '0';
+	while (value >= 10) {
+	  value -= 10;
+	  digit++;
+	}
+	*p++ = digit;
+  }
+  *p++ = '0' + value;
+  *p = '\0';
+  return p;
+}
+
+char *formatDec(char *dst, uint16_t value) {
+  if (value < 256) return formatDec(dst, (uint8_t)value);
+
+  char *p = dst;
+  uint8_t i = 4;
+  while (value < pgm_read_word(&powersOfTen16[i])) i--;
+  for (; i > 0; i--) {
+	const uint16_t power = pgm_read_word(&powersOfTen16[i]);
+	char digit = '0';
+	while (value >= power) {
+	  value -= power;
+	  digit++;
+	}
+	*p++ = digit;
+  }
+  *p++ = '0' + (uint8_t)value;
+  *p = '\0';
+  return p;
+}
+
+char *formatDec(char *dst, uint32_t value) {
+  if (value <= 0xffff) return formatDec(dst, (uint16_t)value);
+
+  char *p = dst;
+  uint8_t i = 9;
+  while (value < pgm_read_dword(&powersOfTen[i])) i--;
+  for (; i >= 4; i--) {
+	const uint32_t power = pgm_read_dword(&powersOfTen[i]);
+	char digit = '0';
+	while (value >= power) {
+	  value -= power;
+	  digit++;
+	}
+	*p++ = digit;
+  }
+
+  // the remaining four digits fit into 16 bits
+  uint16_t rest = value;
+  for (; i > 0; i--) {
+	const uint16_t power = pgm_read_word(&powersOfTen16[i]);
+	char digit = '0';
+	while (rest >= power) {
+	  rest -= power;
+	  digit++;
+	}
+	*p++ = digit;
+  }
+  *p++ = '0' + (uint8_t)rest;
+  *p = '\0';
+  return p;
+}
+
+char *formatDec(char *dst, const int8_t value) {
+  if (value >= 0) return formatDec(dst, (uint8_t)value);
+  *dst = '-';
+  return formatDec(dst + 1, (uint8_t)(0 - (uint8_t)value));
+}
+
+char *formatDec(char *dst, const int16_t value) {
+  if (value >= 0) return formatDec(dst, (uint16_t)value);
+  *dst = '-';
+  return formatDec(dst + 1, (uint16_t)(0 - (uint16_t)value));
+}
+
+char *formatDec(char *dst, const int32_t value) {
+  if (value >= 0) return formatDec(dst, (uint32_t)value);
+  *dst = '-';
+  return formatDec(dst + 1, (uint32_t)(0 - (uint32_t)value));
+}
+
+Print& operator <<(Print &obj, const uint8_t arg) {
+  char buffer[4];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+Print& operator <<(Print &obj, const uint16_t arg) {
+  char buffer[6];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+Print& operator <<(Print &obj, const uint32_t arg) {
+  char buffer[11];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+Print& operator <<(Print &obj, const int8_t arg) {
+  char buffer[5];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+Print& operator <<(Print &obj, const int16_t arg) {
+  char buffer[7];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+Print& operator <<(Print &obj, const int32_t arg) {
+  char buffer[12];
+  obj.write(buffer, formatDec(buffer, arg) - buffer);
+  return obj;
+}
+
+char *formatHex(char *dst, uint32_t value, const uint8_t width) {
+  char *p = dst + width;
+  *p = '\0';
+  while (p > dst) {
+	const uint8_t nibble = value & 0x0f;
+	*--p = (nibble < 10) ? ('0' + nibble) : ('a' - 10 + nibble);
+	value >>= 4;
+  }
+  return dst + width;
+}
+
+char *formatBin(char *dst, uint32_t value, const uint8_t width) {
+  char *p = dst + width;
+  *p = '\0';
+  while (p > dst) {
+	*--p = '0' + (value & 0x01);
+	value >>= 1;
+  }
+  return dst + width;
+}
+
+HexBuf<8> toBinaryBuf(const uint8_t value) {
+  HexBuf<8> buffer;
+  formatBin(buffer.str, value, 8);
+  return buffer;
+}
+
+HexBuf<2> toHexBuf(const uint8_t value) {
+  HexBuf<2> buffer;
+  formatHex(buffer.str, value, 2);
+  return buffer;
+}
+
+HexBuf<4> toHexBuf(const uint16_t value) {
+  HexBuf<4> buffer;
+  formatHex(buffer.str, value, 4);
+  return buffer;
+}
+
+HexBuf<8> toHexBuf(const uint32_t value) {
+  HexBuf<8> buffer;
+  formatHex(buffer.str, value, 8);
+  return buffer;
+}
+
+HexBuf<2*sizeof(void *)> toHexBuf(const void *ptr) {
+  HexBuf<2*sizeof(void *)> buffer;
+  formatHex(buffer.str, (uintptr_t)ptr, 2*sizeof(void *));
+  return buffer;
+}
+
+Print& operator <<(Print &obj, const HexManip &arg) {
+  uint8_t shift = 4 * arg.width;
+  while (shift) {
+	shift -= 4;
+	const uint8_t nibble = (arg.value >> shift) & 0x0f;
+	obj.write((nibble < 10) ? ('0' + nibble) : ('a' - 10 + nibble));
+  }
+  return obj;
+}
+
+Print& operator <<(Print &obj, const BinManip &arg) {
+  uint8_t shift = arg.width;
+  while (shift) {
+	shift--;
+	obj.write('0' + ((arg.value >> shift) & 0x01));
+  }
+  return obj;
+}
+
+/*
+ * Print the decimal value most significant digit first by subtracting
+ * powers of ten, so no buffer and no 32-bit division is needed.
+ */
+Print& operator <<(Print &obj, const PadManip &arg) {
+  uint32_t value = arg.value;
+  uint8_t digits = 1;
+  while ((digits < 10) && (value >= pgm_read_dword(&powersOfTen[digits]))) digits++;
+
+  uint8_t len = digits + (arg.negative ? 1 : 0);
+  if (arg.negative && ('0' == arg.fill)) obj.write('-');
+  for (; len < arg.width; len++) obj.write(arg.fill);
+  if (arg.negative && ('0' != arg.fill)) obj.write('-');
+
+  while (--digits) {
+	const uint32_t power = pgm_read_dword(&powersOfTen[digits]);
+	char digit = '0';
+	while (value >= power) {
+	  value -= power;
+	  digit++;
+	}
+	obj.write(digit);
+  }
+  obj.write('0' + (uint8_t)value);
+  return obj;
+}
+
+void NumberParser::reset(const uint8_t base) {
+  this->value = 0;
+  this->base = base;
+  this->state = PARSE_IDLE;
+  this->digits = 0;
+  this->negative = false;
+  this->sign = false;
+  this->prefix = false;
+}
+
+/*
+ * Returns the value of a digit or 0xff, if the character is no digit.
+ */
+static uint8_t digitValue(const char c) {
+  if ((c >= '0') && (c <= '9')) return c - '0';
+  if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+  if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+  return 0xff;
+}
+
+/*
+ * Returns the lower case letter of the prefix for a base like "0x" or '\0'.
+ */
+static char prefixOf(const uint8_t base) {
+  if (16 == base) return 'x';
+  if (2 == base) return 'b';
+  return '\0';
+}
+
+NumberParser::State NumberParser::feed(const char c, const uint8_t base) {
+  if ((PARSE_DONE == state) || (PARSE_ERROR == state)) reset(base);
+  else if (PARSE_IDLE == state) this->base = base;
+
+  const uint8_t digit = digitValue(c);
+  if (digit >= this->base) {
+	if (PARSE_NUMBER == state) {
+	  // accept a prefix "0x" or "0b" after a single leading zero
+	  if (!prefix && (1 == digits) && (0 == value) && ((c | 0x20) == prefixOf(this->base))) {
+		digits = 0;
+		prefix = true;
+		return (State)state;
+	  }
+	  state = (digits > 0) ? PARSE_DONE : PARSE_ERROR;
+	}
+	else if ((' ' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c)) {
+	  if (sign) state = PARSE_ERROR;
+	}
+	else if ((('-' == c) || ('+' == c)) && (10 == this->base) && !sign) {
+	  sign = true;
+	  negative = ('-' == c);
+	}
+	else state = PARSE_ERROR;
+	return (State)state;
+  }
+
+  // check for overflow before shifting in the next digit
+  bool overflow;
+  switch (this->base) {
+	case 2:  overflow = (value >> 31); break;
+	case 16: overflow = (value >> 28); break;
+	default: overflow = (value > 429496729UL) || ((429496729UL == value) && (digit > 5)); break;
+  }
+  if (overflow) {
+	state = PARSE_ERROR;
+	return (State)state;
+  }
+  switch (this->base) {
+	case 2:  value = (value << 1) | digit; break;
+	case 16: value = (value << 4) | digit; break;
+	default: value = (value << 3) + (value << 1) + digit; break;
+  }
+  if (negative && (value > 0x80000000UL)) {
+	state = PARSE_ERROR;
+	return (State)state;
+  }
+  if (digits < 0xff) digits++;
+  state = PARSE_NUMBER;
+  return (State)state;
+}
+
+/*
+ * Signal the end of the input, which terminates a number being received.
+ */
+NumberParser::State NumberParser::finish() {
+  if (PARSE_NUMBER == state) {
+	state = (digits > 0) ? PARSE_DONE : PARSE_ERROR;
+  }
+  else if (PARSE_IDLE == state) {
+	state = PARSE_ERROR;
+  }
+  return (State)state;
+}
+
+/*
+ * Consume the available characters of the Stream until the number is complete.
+ * The character terminating the number is left in the Stream.
+ */
+NumberParser::State NumberParser::parse(Stream &in, const uint8_t base) {
+  while (in.available() > 0) {
+	const State rc = feed(in.peek(), base);
+	if (PARSE_DONE == rc) return rc;
+	in.read();
+	if (PARSE_ERROR == rc) return rc;
+  }
+  return (State)state;
+}
+
+static const char *parseSpan(const char *begin, const char *end, const uint8_t base, NumberParser &parser) {
+  parser.reset(base);
+  const char *p = begin;
+  for (; p < end; p++) {
+	const NumberParser::State rc = parser.feed(*p, base);
+	if (NumberParser::PARSE_DONE == rc) return p;
+	if (NumberParser::PARSE_ERROR == rc) return 0L;
+  }
+  return (NumberParser::PARSE_DONE == parser.finish()) ? p : 0L;
+}
+
+const char *parseBin(const char *begin, const char *end, uint32_t &value) {
+  NumberParser parser;
+  const char *p = parseSpan(begin, end, 2, parser);
+  if (p) value = parser.getValue();
+  return p;
+}
+
+const char *parseDec(const char *begin, const char *end, int32_t &value) {
+  NumberParser parser;
+  const char *p = parseSpan(begin, end, 10, parser);
+  if (!p) return 0L;
+  // the parser accepts up to 4294967295, which does not fit into an int32_t
+  if (!parser.isNegative() && (parser.getValue() > 0x7fffffffUL)) return 0L;
+  value = parser.getSignedValue();
+  return p;
+}
+
+const char *parseHex(const char *begin, const char *end, uint32_t &value) {
+  NumberParser parser;
+  const char *p = parseSpan(begin, end, 16, parser);
+  if (p) value = parser.getValue();
+  return p;
+}
+
+#ifndef TRAPPMANNROBOTICS_NO_STRING
 String toBinaryString(const uint8_t value) {
-  static String buffer;
-  buffer = "0000000" + String(value, BIN);
-  return buffer.substring(buffer.length()-8);
+  return String(toBinaryBuf(value).str);
 }
 
 String toHexString(const uint8_t value) {
-  static String buffer;
-  buffer = "0" + String(value, HEX);
-  return buffer.substring(buffer.length()-2);  
+  return String(toHexBuf(value).str);
 }
 
 String toHexString(const uint16_t value) {
-  static String buffer;
-  buffer = "000" + String(value, HEX);
-  return buffer.substring(buffer.length()-4);  
+  return String(toHexBuf(value).str);
 }
 
 String toHexString(const uint32_t value) {
-  static String buffer;
-  buffer = "0000000" + String(value, HEX);
-  return buffer.substring(buffer.length()-8);  
+  return String(toHexBuf(value).str);
 }
 
 String toHexString(const void *ptr) {
-#if !defined(TEENSYDUINO)
-  if (2 == sizeof(void *)) {
-	return toHexString((uint16_t)ptr);
-  }
-  else
+  return String(toHexBuf(ptr).str);
+}
 #endif
-	  return toHexString((uint32_t)ptr);
+
+/*
+ * Find the element after the last path separator.
+ */
+PathView baseNameView(const char *path) {
+  const char *baseName = path;
+  for (const char *p = path; *p; p++) {
+	if (isPathSeparator(*p)) baseName = p + 1;
+  }
+  PathView view = { baseName, strlen(baseName) };
+  return view;
 }
 
-String getBaseName(const char *path) {
-  const String pathName = path;
-  int idx = pathName.lastIndexOf('\\');
-  String baseName;
-  if (idx > 0) {
-	baseName = pathName.substring(idx+1);
-  } else {
-	baseName = pathName;
+/*
+ * The path is everything in front of the last separator. A separator at the
+ * beginning denotes the root directory, no separator the current directory.
+ */
+PathView pathNameView(const char *path) {
+  const PathView baseName = baseNameView(path);
+  PathView view = { path, (size_t)(baseName.str - path) };
+  if (view.len > 1) {
+	view.len--;
+  }
+  else if (0 == view.len) {
+	view.str = ".";
+	view.len = 1;
   }
-  return baseName;
+  return view;
 }
-	
+
+#ifndef TRAPPMANNROBOTICS_NO_STRING
+String getBaseName(const char *path) {
+  return String(baseNameView(path).str);
+}
+
 String getPathName(const char *path) {
-  const String fullPathName = path;
-  int idx = fullPathName.lastIndexOf('\\');
+  const PathView view = pathNameView(path);
   String pathName;
-  if (idx > 0) {
-	pathName = fullPathName.substring(0, idx);
-  } else {
-	pathName = ".";
-  }
+  pathName.reserve(view.len);
+  for (size_t i=0; i<view.len; i++) pathName += view.str[i];
   return pathName;
 }
+#endif
@@ -33,6 +33,9 @@
 
 #include <WString.h>
 #include <Print.h>
+#include <Stream.h>
+#include <avr/pgmspace.h>
+#include <TrappmannRobotics_StaticString.h>
 
 #if defined(__avr__)
 #define LF '\n'
@@ -44,18 +47,265 @@
 
 // Printing with stream operator
 template<class T> inline Print& operator <<(Print &obj, T arg) { obj.print(arg); return obj; }
+#ifndef TRAPPMANNROBOTICS_NO_STRING
+// A String is passed by reference, so it is not copied on the heap.
+inline Print& operator <<(Print &obj, const String &arg) { obj.print(arg); return obj; }
+#endif
 //inline Print& operator <<(Print &obj, float arg) { obj.print(arg, 4); return obj; }
 
-// Hex and Binary printing
+// Integers are printed with fast decimal kernels instead of Print::print(),
+// which divides by 10 for every digit. The output is identical.
+Print& operator <<(Print &obj, const uint8_t arg);
+Print& operator <<(Print &obj, const uint16_t arg);
+Print& operator <<(Print &obj, const uint32_t arg);
+Print& operator <<(Print &obj, const int8_t arg);
+Print& operator <<(Print &obj, const int16_t arg);
+Print& operator <<(Print &obj, const int32_t arg);
+
+// Allocation-free formatting into a caller supplied buffer, which must provide
+// room for width+1 characters. The value is filled up with leading zeros or
+// truncated to exactly width digits. Returns a pointer to the terminating NUL.
+char *formatHex(char *dst, uint32_t value, const uint8_t width);
+char *formatBin(char *dst, uint32_t value, const uint8_t width);
+
+// Allocation-free decimal formatting without leading zeros. The buffer must
+// provide room for 4/6/11 characters for 8/16/32-bit values including sign
+// and NUL. Returns a pointer to the terminating NUL.
+char *formatDec(char *dst, uint8_t value);
+char *formatDec(char *dst, uint16_t value);
+char *formatDec(char *dst, uint32_t value);
+char *formatDec(char *dst, const int8_t value);
+char *formatDec(char *dst, const int16_t value);
+char *formatDec(char *dst, const int32_t value);
+
+// Fixed size result of the allocation-free formatters holding N digits.
+template<uint8_t N> struct HexBuf {
+  char str[N+1];
+
+  const char *c_str() const { return str; }
+  operator const char *() const { return str; }
+};
+template<uint8_t N> inline Print& operator <<(Print &obj, const HexBuf<N> &arg) { obj.write(arg.str, N); return obj; }
+
+HexBuf<8> toBinaryBuf(const uint8_t value);
+
+HexBuf<2> toHexBuf(const uint8_t value);
+HexBuf<4> toHexBuf(const uint16_t value);
+HexBuf<8> toHexBuf(const uint32_t value);
+HexBuf<2*sizeof(void *)> toHexBuf(const void *ptr);
+
+/*
+ * Print adapter, which collects the output of an operator<< chain in a fixed
+ * buffer and passes it on with a single write to the underlying Print object.
+ * The buffer is flushed on a newline, when it is full or by calling flush().
+ * flush() does not wait for the underlying Print object to finish sending.
+ */
+template<uint8_t N> class BufferedPrint : public Print {
+private:
+  Print &out;
+  uint8_t buffer[N];
+  uint8_t used;
+  uint32_t bytes;	// number of bytes passed on
+  uint32_t calls;	// number of write calls received
+  uint32_t writes;	// number of write calls issued to out
+
+public:
+  BufferedPrint(Print &out) : out(out), used(0), bytes(0), calls(0), writes(0) {}
+  ~BufferedPrint() { flush(); }
+
+  virtual size_t write(uint8_t c) {
+	calls++;
+	put(c);
+	return 1;
+  }
+
+  virtual size_t write(const uint8_t *data, size_t len) {
+	calls++;
+	for (size_t i=0; i<len; i++) put(data[i]);
+	return len;
+  }
+
+  void flush() {
+	if (used) {
+	  out.write(buffer, used);
+	  writes++;
+	  bytes += used;
+	  used = 0;
+	}
+  }
+
+  uint32_t getBytes() const { return bytes; }
+  uint32_t getCalls() const { return calls; }
+  uint32_t getWrites() const { return writes; }
+  uint32_t getWritesSaved() const { return calls - writes; }
+
+private:
+  void put(const uint8_t c) {
+	buffer[used++] = c;
+	if ((N == used) || ('\n' == c)) flush();
+  }
+};
+
+// Stream manipulators, which are rendered digit by digit into the Print sink
+// without any intermediate buffer, ie. Serial << hex16(addr) << padLeft(n, 5, '0')
+struct HexManip { uint32_t value; uint8_t width; };
+struct BinManip { uint32_t value; uint8_t width; };
+struct PadManip { uint32_t value; bool negative; uint8_t width; char fill; };
+
+inline HexManip hex8(const uint8_t value)   { HexManip m = { value, 2 }; return m; }
+inline HexManip hex16(const uint16_t value) { HexManip m = { value, 4 }; return m; }
+inline HexManip hex32(const uint32_t value) { HexManip m = { value, 8 }; return m; }
+inline HexManip hexPtr(const void *p)      { HexManip m = { (uint32_t)(uintptr_t)p, 2*sizeof(void *) }; return m; }
+inline BinManip bin8(const uint8_t value)   { BinManip m = { value, 8 }; return m; }
+
+inline PadManip padLeft(const unsigned long value, const uint8_t width, const char fill = ' ') {
+  PadManip m = { (uint32_t)value, false, width, fill }; return m;
+}
+inline PadManip padLeft(const long value, const uint8_t width, const char fill = ' ') {
+  PadManip m = { (uint32_t)((value < 0) ? 0UL - (unsigned long)value : (unsigned long)value), (value < 0), width, fill }; return m;
+}
+inline PadManip padLeft(const unsigned int value, const uint8_t width, const char fill = ' ') { return padLeft((unsigned long)value, width, fill); }
+inline PadManip padLeft(const int value, const uint8_t width, const char fill = ' ') { return padLeft((long)value, width, fill); }
+
+Print& operator <<(Print &obj, const HexManip &arg);
+Print& operator <<(Print &obj, const BinManip &arg);
+Print& operator <<(Print &obj, const PadManip &arg);
+
+/*
+ * Incremental parser for binary, decimal and hexadecimal numbers. Characters
+ * are consumed one at a time by a state machine without any allocation, so
+ * input arriving in pieces between loop() iterations can be parsed without
+ * blocking. Leading blanks and line ends are skipped, so the terminator of the
+ * previous number does not cause an error. Decimal numbers may have a sign and
+ * hexadecimal or binary numbers an optional "0x" or "0b" prefix. A number is
+ * complete with the first character which is not a digit, which is left in
+ * the Stream. Feeding a parser which is done or failed starts a new number.
+ */
+class NumberParser {
+public:
+  enum State {
+	PARSE_IDLE = 0,		// waiting for the first digit
+	PARSE_NUMBER = 1,	// digits are being received
+	PARSE_DONE = 2,		// number complete, value is valid
+	PARSE_ERROR = 3		// invalid character or overflow
+  };
+
+private:
+  uint32_t value;
+  uint8_t base;
+  uint8_t state;
+  uint8_t digits;
+  bool negative;
+  bool sign;		// a sign was received
+  bool prefix;		// a prefix "0x" or "0b" was received
+
+public:
+  NumberParser() { reset(10); }
+
+  void reset(const uint8_t base);
+  State feed(const char c, const uint8_t base);
+  State finish();
+  State parse(Stream &in, const uint8_t base);
+
+  State getState() const { return (State)state; }
+  uint32_t getValue() const { return value; }
+  int32_t getSignedValue() const { return (int32_t)(negative ? 0UL - value : value); }
+  bool isNegative() const { return negative; }
+};
+
+// Parse the number from the characters available in the Stream.
+inline NumberParser::State parseBin(Stream &in, NumberParser &parser) { return parser.parse(in, 2); }
+inline NumberParser::State parseDec(Stream &in, NumberParser &parser) { return parser.parse(in, 10); }
+inline NumberParser::State parseHex(Stream &in, NumberParser &parser) { return parser.parse(in, 16); }
+
+// Parse a number from the span [begin, end). Returns a pointer to the first
+// character after the number or NULL, if no valid number was found.
+const char *parseBin(const char *begin, const char *end, uint32_t &value);
+const char *parseDec(const char *begin, const char *end, int32_t &value);
+const char *parseHex(const char *begin, const char *end, uint32_t &value);
+
+// Hex and Binary printing, appended to a StaticString
+template<uint8_t N> inline StaticString<N>& toBinaryString(StaticString<N> &dst, const uint8_t value) { dst << toBinaryBuf(value); return dst; }
+
+template<uint8_t N> inline StaticString<N>& toHexString(StaticString<N> &dst, const uint8_t value) { dst << toHexBuf(value); return dst; }
+template<uint8_t N> inline StaticString<N>& toHexString(StaticString<N> &dst, const uint16_t value) { dst << toHexBuf(value); return dst; }
+template<uint8_t N> inline StaticString<N>& toHexString(StaticString<N> &dst, const uint32_t value) { dst << toHexBuf(value); return dst; }
+template<uint8_t N> inline StaticString<N>& toHexString(StaticString<N> &dst, const void *ptr) { dst << toHexBuf(ptr); return dst; }
+
+/*
+ * Defining TRAPPMANNROBOTICS_NO_STRING before including this header removes all
+ * functions using the Arduino String class. Instead, the functions return a
+ * StaticString, so a Sketch can be built without any heap usage.
+ */
+#ifdef TRAPPMANNROBOTICS_NO_STRING
+#ifndef TRAPPMANNROBOTICS_PATH_LENGTH
+#define TRAPPMANNROBOTICS_PATH_LENGTH	32
+#endif
+
+static inline StaticString<8> toBinaryString(const uint8_t value) { return StaticString<8>(toBinaryBuf(value).str); }
+
+static inline StaticString<2> toHexString(const uint8_t value) { return StaticString<2>(toHexBuf(value).str); }
+static inline StaticString<4> toHexString(const uint16_t value) { return StaticString<4>(toHexBuf(value).str); }
+static inline StaticString<8> toHexString(const uint32_t value) { return StaticString<8>(toHexBuf(value).str); }
+static inline StaticString<2*sizeof(void *)> toHexString(const void *ptr) { return StaticString<2*sizeof(void *)>(toHexBuf(ptr).str); }
+#else
 String toBinaryString(const uint8_t value);
 
 String toHexString(const uint8_t value);
 String toHexString(const uint16_t value);
 String toHexString(const uint32_t value);
 String toHexString(const void *ptr); 
+#endif
+
+// Extract filename from path at compile time. Both '/' and '\\' are accepted
+// as separator. constBaseName returns a pointer into the given string literal,
+// constPathNameLength the number of characters of the leading path.
+constexpr bool isPathSeparator(const char c) { return ('/' == c) || ('\\' == c); }
+constexpr const char *constBaseName(const char *path, const char *last) {
+  return ('\0' == *path) ? last : constBaseName(path + 1, isPathSeparator(*path) ? path + 1 : last);
+}
+constexpr const char *constBaseName(const char *path) { return constBaseName(path, path); }
+constexpr size_t constBaseNameOffset(const char *path) { return constBaseName(path) - path; }
+constexpr size_t constPathNameLength(const char *path) {
+  return (constBaseNameOffset(path) > 1) ? constBaseNameOffset(path) - 1 : constBaseNameOffset(path);
+}
+
+// Forces evaluation of a constexpr offset at compile time.
+template<size_t N> struct ConstOffset { static const size_t value = N; };
+
+// Name of the current source file as flash string, ie. Serial << SKETCH_NAME;
+// Like F() this can only be used inside of a function.
+#define SKETCH_NAME (__extension__({ \
+  static const char __sketchPath[] PROGMEM = __FILE__; \
+  reinterpret_cast<const __FlashStringHelper *>(&__sketchPath[ConstOffset<constBaseNameOffset(__FILE__)>::value]); }))
 
+// Zero-copy view to a part of a path string.
+struct PathView {
+  const char *str;
+  size_t len;
+};
+inline Print& operator <<(Print &obj, const PathView &arg) { obj.write(arg.str, arg.len); return obj; }
+
+PathView baseNameView(const char *path);
+PathView pathNameView(const char *path);
+
+// Extract filename from path, appended to a StaticString
+template<uint8_t N> inline StaticString<N>& getBaseName(StaticString<N> &dst, const char *path) { dst << baseNameView(path); return dst; }
+template<uint8_t N> inline StaticString<N>& getPathName(StaticString<N> &dst, const char *path) { dst << pathNameView(path); return dst; }
+
+#ifdef TRAPPMANNROBOTICS_NO_STRING
+static inline StaticString<TRAPPMANNROBOTICS_PATH_LENGTH> getBaseName(const char *path) {
+  StaticString<TRAPPMANNROBOTICS_PATH_LENGTH> baseName;
+  return getBaseName(baseName, path);
+}
+static inline StaticString<TRAPPMANNROBOTICS_PATH_LENGTH> getPathName(const char *path) {
+  StaticString<TRAPPMANNROBOTICS_PATH_LENGTH> pathName;
+  return getPathName(pathName, path);
+}
+#else
 // Extract filename from path
 String getBaseName(const char *path);
 String getPathName(const char *path);
+#endif
 
 #endif /* STRINGHELPER_H */
@@ -30,9 +30,17 @@
 //
 #include <TrappmannRobotics.h>
 #include "TrappmannRobotics_System.h"
+#include "TrappmannRobotics/Crc16.h"
 #include <Arduino.h>
 
 #if defined(__avr__)
+#include <stddef.h>
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include <avr/power.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#include <util/atomic.h>
 
 /*
  * First, we need a variable to hold the reset cause that can be written before
@@ -56,6 +64,12 @@ void resetFlagsInit(void) {
   __asm__ __volatile__ ("sts %[RESETFLAGS], r2\n" : [RESETFLAGS] "=m" (resetFlags) :);
 }
 
+// Timer1 ticks of the boot phases, see TRAPPMANNROBOTICS_BOOT_PROFILE. Only
+// written by asm, so LTO must neither drop nor localize it.
+uint16_t systemBootTicks[3] __attribute__ ((used, externally_visible));
+static uint32_t setupBeginMicros = 0;
+static uint32_t setupDoneMicros = 0;
+
 System::System() {
   // never called, but necessary for linking otherwise resetFlagsInit will be removed by the optimizer!
   if (0xee == resetFlags) resetFlagsInit();
@@ -110,6 +124,261 @@ void System::printResetFlags(Print& out) {
   out.println();
 }
 
+/*
+ * The crash record is kept in the same .noinit section as the reset flags, so
+ * it survives the reset by the watchdog. The tag is set by the Sketch while
+ * running, ie. to the id of the active subsystem, and copied on a crash.
+ */
+static CrashRecord crashRecord __attribute__ ((section(".noinit")));
+static volatile uint16_t crashTag = 0;
+
+/*
+ * The 16-bit tag is written in two steps, so the interrupts are disabled to
+ * keep captureCrash() in the ISR from reading half of it.
+ */
+void System::setCrashTag(const uint16_t tag) {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+	crashTag = tag;
+  }
+}
+
+/*
+ * Fast enough to be called from an ISR, ie. the Watchdog callback, as it only
+ * writes to RAM. The EEPROM can be written later from setup().
+ */
+void System::captureCrash(const uint32_t pc) {
+  crashRecord.magic = CRASHRECORD_MAGIC;
+  crashRecord.pc = pc;
+  crashRecord.sp = SP;
+  crashRecord.freeMemory = TrappmannRobotics::getFreeMemory();
+  crashRecord.millis = millis();
+  crashRecord.tag = crashTag;
+  crashRecord.crc = crc16((const uint8_t *)&crashRecord, offsetof(CrashRecord, crc));
+}
+
+/*
+ * After a power-on the .noinit section holds random values, which are rejected
+ * by the magic and the CRC.
+ */
+bool System::hasCrashRecord() {
+  return (CRASHRECORD_MAGIC == crashRecord.magic) &&
+		 (crc16((const uint8_t *)&crashRecord, offsetof(CrashRecord, crc)) == crashRecord.crc);
+}
+
+const CrashRecord& System::getCrashRecord() {
+  return crashRecord;
+}
+
+void System::clearCrashRecord() {
+  crashRecord.magic = 0;
+}
+
+void System::printCrashRecord(Print& out) {
+  if (!hasCrashRecord()) {
+	out << F("no crash record\n");
+	return;
+  }
+  out << F("crash at PC=0x") << hex32(crashRecord.pc) << F(" SP=0x") << hex16(crashRecord.sp)
+	  << F(" free=") << crashRecord.freeMemory << F(" time=") << crashRecord.millis
+	  << F(" ms tag=") << crashRecord.tag << '\n';
+}
+
+/*
+ * Persist the record to the EEPROM, ie. from setup() after the reset. Only
+ * changed bytes are written.
+ */
+void System::saveCrashRecord(const uint16_t addr) {
+  eeprom_update_block(&crashRecord, (void *)addr, sizeof(crashRecord));
+}
+
+bool System::loadCrashRecord(const uint16_t addr) {
+  eeprom_read_block(&crashRecord, (const void *)addr, sizeof(crashRecord));
+  return hasCrashRecord();
+}
+
+/*
+ * Outputs to drive into a safe state on halt, ie. the enable pins of the motor
+ * drivers. Only the port and the bit mask are kept, so the outputs can be set
+ * with direct writes to the port registers without any lookup on halt.
+ */
+struct SafeOutput {
+  uint8_t port;
+  uint8_t mask;
+  uint8_t level;
+};
+static SafeOutput safeOutputs[SYSTEM_SAFE_OUTPUTS];
+static uint8_t safeOutputCount = 0;
+
+/*
+ * Register a pin, which is driven to the given level (LOW or HIGH) when the
+ * system is halted. Returns false, if the pin is invalid or the table is full.
+ */
+bool System::registerSafeOutput(const uint8_t pin, const uint8_t level) {
+  const uint8_t port = digitalPinToPort(pin);
+  if ((NOT_A_PIN == port) || (safeOutputCount >= SYSTEM_SAFE_OUTPUTS)) return false;
+
+  safeOutputs[safeOutputCount].port = port;
+  safeOutputs[safeOutputCount].mask = digitalPinToBitMask(pin);
+  safeOutputs[safeOutputCount].level = level;
+  safeOutputCount++;
+  return true;
+}
+
+/*
+ * Disable the interrupts, stop all timers and disconnect their PWM outputs,
+ * then drive the registered outputs to their safe levels. The port is written
+ * before the pin is switched to output, so it does not glitch. Nothing is
+ * allocated, so it is safe to call while the system is failing. millis() and
+ * delay() will not work afterwards.
+ */
+void System::enterSafeState() {
+  cli();
+#if defined(TCCR0A)
+  TCCR0B = 0; TCCR0A = 0; TIMSK0 = 0;
+#endif
+#if defined(TCCR1A)
+  TCCR1B = 0; TCCR1A = 0; TIMSK1 = 0;
+#endif
+#if defined(TCCR2A)
+  TCCR2B = 0; TCCR2A = 0; TIMSK2 = 0;
+#endif
+#if defined(TCCR3A)
+  TCCR3B = 0; TCCR3A = 0; TIMSK3 = 0;
+#endif
+#if defined(TCCR4A)
+  TCCR4B = 0; TCCR4A = 0; TIMSK4 = 0;
+#endif
+#if defined(TCCR5A)
+  TCCR5B = 0; TCCR5A = 0; TIMSK5 = 0;
+#endif
+
+  for (uint8_t i = 0; i < safeOutputCount; i++) {
+	const SafeOutput& output = safeOutputs[i];
+	volatile uint8_t *out = portOutputRegister(output.port);
+	if (output.level) *out |= output.mask;
+	else *out &= ~output.mask;
+	*portModeRegister(output.port) |= output.mask;
+  }
+}
+
+/*
+ * Sleep in power-down mode for one period of the watchdog, which runs in
+ * interrupt mode without reset. The WDT_vect handlers of the library return at
+ * once in this mode, see CallWithTimeout.cpp and Watchdog.cpp. A CPU sleeping with disabled interrupts is
+ * never woken up again, so the interrupts are enabled right in front of the
+ * SLEEP instruction and disabled again after the wake up. Only timeouts below
+ * WDTO_4S are supported, because WDP3 is not set.
+ */
+static inline void sleepWatchdogPeriod(const uint8_t timeout) {
+  wdt_reset();
+  MCUSR &= ~(1<<WDRF);	// WDE can not be cleared while WDRF is set
+  _WD_CONTROL_REG = (1<<_WD_CHANGE_BIT) | (1<<WDE);
+  _WD_CONTROL_REG = (1<<WDIF) | (1<<WDIE) | timeout;
+#if defined(BODS) && defined(BODSE)
+  sleep_bod_disable();
+#endif
+  sei();
+  sleep_cpu();	// executed before any interrupt after sei
+  cli();
+}
+
+/*
+ * Halt the system in the safe state with the least power consumption. All
+ * peripherals are turned off and the CPU sleeps in power-down mode until the
+ * next reset. With a fault code > 0, the watchdog wakes up the CPU to blink the
+ * LED faultCode times every 2 seconds, at a few microamps between the blinks.
+ * The external and pin change interrupts are masked, so no ISR of the Sketch
+ * runs while the interrupts are enabled for the sleep.
+ */
+void System::haltLowPower(const uint8_t faultCode) {
+  Serial.flush();
+  enterSafeState();
+
+  ADCSRA &= ~(1<<ADEN);	// disable the ADC before turning it off
+  power_all_disable();
+  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+  sleep_enable();
+
+  if (0 == faultCode) {
+	wdt_disable();
+	while (true) sleep_cpu(); // no interrupt left to wake up
+  }
+
+#if defined(EIMSK)
+  EIMSK = 0;
+#endif
+#if defined(PCICR)
+  PCICR = 0;
+#endif
+  const uint8_t ledPort = digitalPinToPort(LED_PIN);
+  const uint8_t ledMask = digitalPinToBitMask(LED_PIN);
+  volatile uint8_t *led = portOutputRegister(ledPort);
+  *portModeRegister(ledPort) |= ledMask;
+  while (true) {
+	for (uint8_t i = 0; i < faultCode; i++) {
+	  *led |= ledMask;
+	  sleepWatchdogPeriod(WDTO_250MS);
+	  *led &= ~ledMask;
+	  sleepWatchdogPeriod(WDTO_250MS);
+	}
+	sleepWatchdogPeriod(WDTO_2S);
+  }
+}
+
+void System::haltLowPower(const __FlashStringHelper *msg, const uint8_t faultCode) {
+  Serial << F("ALERT: ") << msg << '\n';
+  haltLowPower(faultCode);
+}
+
+/*
+ * Call markSetupBegin() first and markSetupDone() last in setup().
+ */
+void System::markSetupBegin() {
+  setupBeginMicros = micros();
+}
+
+void System::markSetupDone() {
+  setupDoneMicros = micros();
+}
+
+static uint32_t bootTicksToMicros(const uint16_t ticks) {
+  return (uint32_t)ticks * 64 / (F_CPU / 1000000UL);
+}
+
+/*
+ * Time in microseconds from ".init0" to the end of setup(). The time spent in
+ * the bootloader before is not included. Without TRAPPMANNROBOTICS_BOOT_PROFILE
+ * only the time from main() is known.
+ */
+uint32_t System::getBootTime() {
+  return bootTicksToMicros(systemBootTicks[BOOT_TICKS_MAIN]) + setupDoneMicros;
+}
+
+static void printBootPhase(Print& out, const __FlashStringHelper *name, const uint32_t time, const uint32_t prev) {
+  out << name << time << F(" us (+") << (time - prev) << F(" us)\n");
+}
+
+void System::printBootProfile(Print& out) {
+  if (0 == systemBootTicks[BOOT_TICKS_MAIN]) {
+	out << F("Boot profile not enabled, see TRAPPMANNROBOTICS_BOOT_PROFILE\n");
+	return;
+  }
+  const uint32_t data = bootTicksToMicros(systemBootTicks[BOOT_TICKS_DATA]);
+  const uint32_t ctors = bootTicksToMicros(systemBootTicks[BOOT_TICKS_CTORS]);
+  const uint32_t mainEntry = bootTicksToMicros(systemBootTicks[BOOT_TICKS_MAIN]);
+
+  out << F("Boot profile since .init0:\n");
+  printBootPhase(out, F(".data/.bss init: "), data, 0);
+  printBootPhase(out, F("constructors:    "), ctors, data);
+  printBootPhase(out, F("main():          "), mainEntry, ctors);
+  if (0 == setupDoneMicros) {
+	out << F("setup() not marked\n");
+	return;
+  }
+  printBootPhase(out, F("setup() begin:   "), mainEntry + setupBeginMicros, mainEntry);
+  printBootPhase(out, F("setup() done:    "), mainEntry + setupDoneMicros, mainEntry + setupBeginMicros);
+}
+
 /*
  * Check if bootloader did pass the status of MCUSR in register R2 to our sketch
  * so that the function resetFlagsInit in section ".init0" could initialize the
@@ -130,6 +399,9 @@ bool System::hasValidResetFlags() {
 void System::halt() {
   Serial << F("Halted! Press RESET to start again\n");
   Serial.flush();
+#if defined(__avr__)
+  enterSafeState();
+#endif
 
   pinMode(LED_PIN, OUTPUT);
   digitalWrite(LED_PIN, HIGH);
@@ -137,7 +409,21 @@ void System::halt() {
   exit(0); // halt system
 }
 
-void System::halt(const String& msg) {
-  Serial << "ALERT: " << msg << '\n';
+void System::halt(const char *msg) {
+  Serial << F("ALERT: ") << msg << '\n';
+  halt();
+}
+
+void System::halt(const __FlashStringHelper *msg) {
+  Serial << F("ALERT: ") << msg << '\n';
   halt();
 }
+
+#ifndef TRAPPMANNROBOTICS_NO_STRING
+/*
+ * The String is neither copied nor concatenated, so no memory is allocated.
+ */
+void System::halt(const String& msg) {
+  halt(msg.c_str());
+}
+#endif
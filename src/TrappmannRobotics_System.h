@@ -33,6 +33,85 @@
 
 #include <stdint.h>
 #include <Print.h>
+#include <TrappmannRobotics_StaticString.h>
+
+#if defined(__avr__)
+#include <avr/io.h>
+
+#define CRASHRECORD_MAGIC	0xc4a5
+#define SYSTEM_SAFE_OUTPUTS	8	// max. number of outputs for registerSafeOutput()
+
+/*
+ * State of the Sketch when it crashed, ie. captured in the Watchdog callback.
+ * The record is kept in the .noinit section, so it survives the reset.
+ */
+struct CrashRecord {
+  uint16_t magic;
+  uint32_t pc;
+  uint16_t sp;
+  uint16_t freeMemory;
+  uint32_t millis;
+  uint16_t tag;
+  uint16_t crc;		// CRC-16 of all fields before
+};
+
+// Index of the boot phases in systemBootTicks.
+#define BOOT_TICKS_DATA		0	// .data and .bss initialized
+#define BOOT_TICKS_CTORS	1	// static constructors done
+#define BOOT_TICKS_MAIN		2	// main() entered
+extern uint16_t systemBootTicks[3];
+
+/*
+ * Put TRAPPMANNROBOTICS_BOOT_PROFILE once into the Sketch to enable the boot
+ * profile. It starts Timer1 in ".init0" with prescaler 64, which counts 4us per
+ * tick at 16MHz and overflows after 262ms. r1 is not cleared before ".init2",
+ * so only r24 is used. The later phases are read after the .data and .bss
+ * sections are initialized. Timer1 is reconfigured by init() in main(), so
+ * setup() is measured by micros() relative to ".init8". The naked functions
+ * contain basic asm only, so the register addresses of Timer1 are given as
+ * numbers, which are the same on all supported MCUs. On other MCUs, ie. an
+ * ATtiny85 without Timer1, the macro does nothing.
+ */
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__) || \
+	defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__) || defined(__AVR_ATmega32U4__)
+#define BOOT_TIMER_ASM_EQU \
+  ".equ TCCR1A, 0x80              ; register addresses of Timer1\n\t" \
+  ".equ TCCR1B, 0x81\n\t" \
+  ".equ TCNT1L, 0x84\n\t" \
+  ".equ TCNT1H, 0x85\n\t"
+// store TCNT1 into systemBootTicks at the byte offset ofs, low byte first
+#define BOOT_TIMER_ASM_STORE(ofs) \
+  BOOT_TIMER_ASM_EQU \
+  "	lds  r24, TCNT1L            ; reading the low byte latches the high byte\n\t" \
+  "	lds  r25, TCNT1H\n\t" \
+  "	sts  systemBootTicks+" #ofs ", r24\n\t" \
+  "	sts  systemBootTicks+" #ofs "+1, r25\n\t"
+
+#define TRAPPMANNROBOTICS_BOOT_PROFILE \
+  void bootTimerInit(void) __attribute__ ((naked, used)) __attribute__ ((section(".init0"))); \
+  void bootTimerInit(void) { \
+	__asm__ __volatile__ ( \
+	  BOOT_TIMER_ASM_EQU \
+	  "	ldi  r24, 0                 ; stop Timer1, if left running by the bootloader\n\t" \
+	  "	sts  TCCR1B, r24\n\t" \
+	  "	sts  TCCR1A, r24            ; normal mode\n\t" \
+	  "	sts  TCNT1H, r24            ; clear counter, high byte first\n\t" \
+	  "	sts  TCNT1L, r24\n\t" \
+	  "	ldi  r24, 0x03              ; start with prescaler 64 (CS11 | CS10)\n\t" \
+	  "	sts  TCCR1B, r24\n\t" \
+	); \
+  } \
+  void bootTimerData(void) __attribute__ ((naked, used)) __attribute__ ((section(".init5"))); \
+  void bootTimerData(void) { __asm__ __volatile__ (BOOT_TIMER_ASM_STORE(0)); }	/* BOOT_TICKS_DATA */ \
+  void bootTimerCtors(void) __attribute__ ((naked, used)) __attribute__ ((section(".init7"))); \
+  void bootTimerCtors(void) { __asm__ __volatile__ (BOOT_TIMER_ASM_STORE(2)); }	/* BOOT_TICKS_CTORS */ \
+  void bootTimerMain(void) __attribute__ ((naked, used)) __attribute__ ((section(".init8"))); \
+  void bootTimerMain(void) { __asm__ __volatile__ (BOOT_TIMER_ASM_STORE(4)); }	/* BOOT_TICKS_MAIN */ \
+  extern uint16_t systemBootTicks[3]
+#else
+#define TRAPPMANNROBOTICS_BOOT_PROFILE	extern uint16_t systemBootTicks[3]
+#endif
+#endif /* __avr__ */
 
 class System {
 #if defined(__avr__)
@@ -51,11 +130,35 @@ public:
   static bool isResetByExtern();
   static bool isResetByPowerOn();
   static void printResetFlags(Print& out);
+
+  static void setCrashTag(const uint16_t tag);
+  static void captureCrash(const uint32_t pc);
+  static bool hasCrashRecord();
+  static const CrashRecord& getCrashRecord();
+  static void clearCrashRecord();
+  static void printCrashRecord(Print& out);
+  static void saveCrashRecord(const uint16_t addr);
+  static bool loadCrashRecord(const uint16_t addr);
+
+  static bool registerSafeOutput(const uint8_t pin, const uint8_t level);
+  static void enterSafeState();
+  static void haltLowPower(const uint8_t faultCode = 0);
+  static void haltLowPower(const __FlashStringHelper *msg, const uint8_t faultCode = 0);
+
+  static void markSetupBegin();
+  static void markSetupDone();
+  static uint32_t getBootTime();
+  static void printBootProfile(Print& out);
 #endif /* __avr__ */
 
 public:
   static void halt();
+  static void halt(const char *msg);
+  static void halt(const __FlashStringHelper *msg);
+  template<uint8_t N> static void halt(const StaticString<N>& msg) { halt(msg.c_str()); }
+#ifndef TRAPPMANNROBOTICS_NO_STRING
   static void halt(const String& msg);
+#endif
 };
 
 #endif /* TRAPPMANNROBOTICS_SYSTEM_H */